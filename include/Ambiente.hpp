@@ -2,6 +2,7 @@
 #define AMBIENTE_HPP
 
 #include "Organismo.hpp"
+#include "Snapshot.hpp"
 #include <string>
 
 enum class TipoEvento {
@@ -14,6 +15,13 @@ enum class TipoEvento {
     TEMPERATURA_EXTREMA
 };
 
+// Condições de repouso de uma zona (para onde ela volta depois dos eventos)
+struct CondicoesZona {
+    float temperaturaBase;
+    float nivelRecursosBase;
+    float taxaConsumo;
+};
+
 class Ambiente {
 private:
     ZonaPlaneta zona;
@@ -25,10 +33,13 @@ private:
     float nivelRecursosBase;
     float taxaConsumo;
     
-    // Evento atual
+    // Relógio da zona (segundos de simulação)
+    double relogio;
+
+    // Evento atual: termina quando o relógio alcança fimEvento
     TipoEvento eventoAtual;
     float duracaoEvento;
-    float tempoRestanteEvento;
+    double fimEvento;
     
     // Consciência da zona
     float consciencia;
@@ -40,18 +51,36 @@ private:
     
 public:
     Ambiente(ZonaPlaneta z);
+    Ambiente(ZonaPlaneta z, const CondicoesZona& condicoes);
     ~Ambiente();
+
+    // Valores do jogo para cada zona
+    static CondicoesZona getCondicoesPadrao(ZonaPlaneta zona);
+
+    // Snapshot (carregar falha se a zona gravada for outra)
+    void salvarEstado(GravadorSnapshot& snapshot, const std::string& prefixo) const;
+    bool carregarEstado(const LeitorSnapshot& snapshot, const std::string& prefixo);
     
     // Getters
     ZonaPlaneta getZona() const { return zona; }
     float getTemperatura() const { return temperatura; }
     float getNivelRecursos() const { return nivelRecursos; }
     float getTaxaConsumo() const { return taxaConsumo; }
+    // taxaConsumo relativa à padrão da zona: multiplica o consumo base de
+    // energia dos organismos (1 com as condições padrão)
+    float getFatorConsumo() const { return taxaConsumo / getCondicoesPadrao(zona).taxaConsumo; }
     TipoEvento getEventoAtual() const { return eventoAtual; }
-    float getTempoRestanteEvento() const { return tempoRestanteEvento; }
+    float getTempoRestanteEvento() const;
     float getConsciencia() const { return consciencia; }
     float getConscienciaMaxima() const { return conscienciaMaxima; }
     int getPopulacaoAtual() const { return populacaoAtual; }
+
+    // Sem evento e já de volta às condições base: temperatura e recursos
+    // ficam constantes até alguém intervir (ver Simulacao::passoRapido)
+    bool estaQuiescente() const {
+        return eventoAtual == TipoEvento::NENHUM &&
+               temperatura == temperaturaBase && nivelRecursos == nivelRecursosBase;
+    }
     
     // Setters
     void setPopulacaoAtual(int pop) { populacaoAtual = pop; }
@@ -73,11 +102,10 @@ public:
     // Utilidades
     std::string getNomeZona() const;
     std::string getDescricaoEvento() const;
-    Color getCorZona() const;
     
 private:
     void aplicarEfeitosEvento();
-    void restaurarCondicoesBase();
+    void restaurarCondicoesBase(float deltaTime);
 };
 
 #endif // AMBIENTE_HPP
\ No newline at end of file
@@ -0,0 +1,40 @@
+#ifndef ARQUIVO_MAPEADO_HPP
+#define ARQUIVO_MAPEADO_HPP
+
+#include <cstddef>
+#include <string>
+
+// Arquivo inteiro mapeado em memória, só para leitura. O conteúdo vem do
+// cache de páginas do sistema sob demanda, sem cópia para um buffer
+// intermediário; quem lê pode usar os bytes no lugar ou copiá-los de uma vez.
+// POSIX (mmap) ou Windows (CreateFileMapping).
+class ArquivoMapeado {
+private:
+    const char* dados;
+    size_t tamanho;
+#ifdef _WIN32
+    void* arquivo;
+    void* mapeamento;
+#else
+    int descritor;
+#endif
+
+public:
+    ArquivoMapeado();
+    ~ArquivoMapeado();
+
+    ArquivoMapeado(const ArquivoMapeado&) = delete;
+    ArquivoMapeado& operator=(const ArquivoMapeado&) = delete;
+
+    // false se o arquivo não existir, estiver vazio ou não puder ser
+    // mapeado. `sequencial` avisa o sistema que a leitura vai do início ao
+    // fim (leitura antecipada mais agressiva).
+    bool abrir(const std::string& caminho, bool sequencial = true);
+    void fechar();
+
+    bool aberto() const { return dados != nullptr; }
+    const char* getDados() const { return dados; }
+    size_t getTamanho() const { return tamanho; }
+};
+
+#endif // ARQUIVO_MAPEADO_HPP
@@ -0,0 +1,101 @@
+#ifndef AUTO_SALVAMENTO_HPP
+#define AUTO_SALVAMENTO_HPP
+
+#include <condition_variable>
+#include <cstddef>
+#include <cstdint>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+class Simulacao;
+
+// Salvamento automático em segundo plano.
+//
+// capturar() roda na thread principal, entre ticks: copia as seções do
+// snapshot para um buffer de captura (só memcpy, sem E/S) e devolve. A thread
+// de fundo compara a captura com o último estado persistido, página a página,
+// e acrescenta ao arquivo "<caminho>.delta" apenas as páginas que mudaram.
+// A cada MAX_DELTAS registros, ou quando os deltas passam de metade da base,
+// grava um snapshot completo em "<caminho>" (arquivo temporário + rename) e
+// recomeça o delta.
+//
+// Formato do delta (ordem de bytes da máquina que gravou):
+//   cabeçalho: "OBDL" + uint32 versão + uint64 geração da base
+//   registros: "OBDR" + uint32 numSecoes, e por seção: nome[32] +
+//              uint64 tamanho + uint32 numPaginas + (uint32 índice + bytes)
+//              por página; termina em "FIMR". Um registro sem "FIMR" (queda
+//              no meio da escrita) é descartado na recuperação.
+class AutoSalvamento {
+public:
+    static constexpr size_t TAMANHO_PAGINA = 4096;
+    static constexpr int MAX_DELTAS = 32;
+
+private:
+    struct Secao {
+        std::string nome;
+        std::vector<char> dados;
+    };
+    using Imagem = std::vector<Secao>;
+
+    std::string caminhoBase;
+    std::string caminhoDelta;
+
+    // `captura` é da thread principal enquanto !pendente e da thread de fundo
+    // enquanto pendente; `gravada` é só da thread de fundo
+    Imagem captura;
+    Imagem gravada;
+    bool temGravada;
+    uint64_t geracao;
+    int numDeltas;
+    uint64_t bytesBase;
+    uint64_t bytesDelta;
+
+    std::thread thread;
+    std::mutex mutex;
+    std::condition_variable cv;
+    bool pendente;
+    bool encerrando;
+
+    // Estatísticas (protegidas por `mutex`)
+    uint64_t totalCapturas;
+    uint64_t capturasDescartadas;
+    uint64_t ultimaGravacaoBytes;
+    bool ultimaFoiCompleta;
+    bool falhou;
+
+    void lacoFundo();
+    bool gravarBase(const Imagem& imagem);
+    bool gravarDelta(const Imagem& imagem);
+
+    static bool gravarImagem(const Imagem& imagem, uint64_t geracao, const std::string& caminho);
+
+public:
+    explicit AutoSalvamento(const std::string& caminho);
+    ~AutoSalvamento();   // termina a gravação em andamento
+
+    AutoSalvamento(const AutoSalvamento&) = delete;
+    AutoSalvamento& operator=(const AutoSalvamento&) = delete;
+
+    // Chamar entre ticks. false se a gravação anterior ainda não terminou;
+    // nesse caso a captura é descartada e nada bloqueia.
+    bool capturar(const Simulacao& sim);
+    // Espera a gravação pendente (se houver)
+    void aguardar();
+
+    // Aplica o delta à base e a regrava como snapshot completo, pronto para
+    // Simulacao::carregarSnapshot(caminho). Sem delta, não mexe em nada.
+    static bool consolidar(const std::string& caminho, std::string& erro);
+    // consolidar() sobre os próprios arquivos; a próxima captura grava uma base nova
+    bool recuperar(std::string& erro);
+
+    const std::string& getCaminho() const { return caminhoBase; }
+    uint64_t getTotalCapturas();
+    uint64_t getCapturasDescartadas();
+    uint64_t getUltimaGravacaoBytes();
+    bool getUltimaFoiCompleta();
+    bool getFalhou();
+};
+
+#endif // AUTO_SALVAMENTO_HPP
@@ -0,0 +1,111 @@
+#ifndef ESPECIES_HPP
+#define ESPECIES_HPP
+
+#include "Organismo.hpp"
+#include <array>
+#include <cstdint>
+
+// Dados fixos de cada espécie, numa tabela montada em tempo de compilação e
+// indexada por TipoOrganismo. Substitui os switch espalhados por Organismo,
+// pelo renderizador e pelo gerenciador de texturas: consultar uma
+// característica é uma leitura indexada.
+struct DescritorEspecie {
+    const char* nome;
+    const char* descricao;
+    const char* caminhoTextura;   // relativo à raiz do projeto
+
+    TipoCategoria categoria;
+    ZonaPlaneta zona;             // zona nativa
+
+    // Atributos iniciais (antes da mutação)
+    float energiaMaxima;
+    float resistenciaTermica;
+    float velocidadeOrbital;
+    float eficienciaMetabolica;
+
+    int idadeMaxima;
+
+    uint8_t cor[4];               // RGBA; o núcleo não conhece o Color do raylib
+};
+
+constexpr const char* DESCRICAO_PADRAO_ESPECIE = "Organismo sintetico do projeto Oblivion";
+
+constexpr std::array<DescritorEspecie, NUM_TIPOS_ORGANISMO> ESPECIES = {{
+    // Núcleo (Zona Vermelha)
+    { "Pyrosynth", "Absorve calor extremo para gerar energia",
+      "assets/images/Pyrosynth_nucleo.png",
+      TipoCategoria::PLANTA, ZonaPlaneta::NUCLEO, 100.0f, 0.95f, 0.1f, 0.7f, 50, {230, 41, 55, 255} },
+    { "Rubraflora", DESCRICAO_PADRAO_ESPECIE,
+      "assets/images/Rubraflor_nucleo.png",
+      TipoCategoria::PLANTA, ZonaPlaneta::NUCLEO, 80.0f, 0.20f, 0.15f, 0.6f, 100, {190, 33, 55, 255} },
+    { "Ignivar", "Corpo energetico instavel, movimenta-se rapidamente",
+      "assets/images/Ignivar_nucleo.png",
+      TipoCategoria::REAGENTE, ZonaPlaneta::NUCLEO, 90.0f, 0.25f, 0.8f, 0.4f, 50, {255, 161, 0, 255} },
+    { "Voltrex", DESCRICAO_PADRAO_ESPECIE,
+      "assets/images/Voltrex_nucleo.png",
+      TipoCategoria::REAGENTE, ZonaPlaneta::NUCLEO, 110.0f, 0.85f, 0.6f, 0.5f, 100, {253, 249, 0, 255} },
+
+    // Zona Habitável (Zona Verde)
+    { "Lumivine", "Fotossintese energetica, beneficia outros organismos",
+      "assets/images/Lumivine_za.png",
+      TipoCategoria::PLANTA, ZonaPlaneta::HABITAVEL, 95.0f, 0.60f, 0.2f, 0.8f, 100, {0, 228, 48, 255} },
+    { "Aeroflora", DESCRICAO_PADRAO_ESPECIE,
+      "assets/images/Aeroflora_za.png",
+      TipoCategoria::PLANTA, ZonaPlaneta::HABITAVEL, 85.0f, 0.55f, 0.5f, 0.65f, 100, {0, 158, 47, 255} },
+    { "Orbiton", DESCRICAO_PADRAO_ESPECIE,
+      "assets/images/Orbiton_za.png",
+      TipoCategoria::REAGENTE, ZonaPlaneta::HABITAVEL, 100.0f, 0.60f, 0.7f, 0.75f, 150, {0, 117, 44, 255} },
+    { "Synapsex", "Aprende com o ambiente, primeiros sinais de consciencia",
+      "assets/images/Synapsex_za.png",
+      TipoCategoria::REAGENTE, ZonaPlaneta::HABITAVEL, 105.0f, 0.58f, 0.5f, 0.85f, 150, {100, 200, 100, 255} },
+
+    // Periferia (Zona Azul). É fria: resistência térmica baixa = melhor adaptação ao frio
+    { "Cryomoss", "Cresce lentamente, armazena energia por longos periodos",
+      "assets/images/Cryomoss_periferia.png",
+      TipoCategoria::PLANTA, ZonaPlaneta::PERIFERIA, 75.0f, 0.15f, 0.1f, 0.9f, 200, {102, 191, 255, 255} },
+    { "Gelibloom", DESCRICAO_PADRAO_ESPECIE,
+      "assets/images/Gelibloom_periferia.png",
+      TipoCategoria::PLANTA, ZonaPlaneta::PERIFERIA, 80.0f, 0.85f, 0.15f, 0.75f, 200, {0, 121, 241, 255} },
+    { "Nullwalker", "Quase invisivel, consome o minimo de energia possivel",
+      "assets/images/Nullwalker_za.png",
+      TipoCategoria::REAGENTE, ZonaPlaneta::PERIFERIA, 60.0f, 0.80f, 0.4f, 0.95f, 120, {0, 82, 172, 255} },
+    { "Huskling", DESCRICAO_PADRAO_ESPECIE,
+      "assets/images/Huskling_periferia.png",
+      TipoCategoria::REAGENTE, ZonaPlaneta::PERIFERIA, 70.0f, 0.18f, 0.3f, 0.65f, 120, {150, 150, 200, 255} },
+}};
+
+constexpr const DescritorEspecie& getEspecie(TipoOrganismo tipo) {
+    return ESPECIES[static_cast<int>(tipo)];
+}
+
+// A tabela segue a ordem do enum: quatro espécies por zona
+static_assert(getEspecie(TipoOrganismo::PYROSYNTH).zona == ZonaPlaneta::NUCLEO, "ordem de ESPECIES");
+static_assert(getEspecie(TipoOrganismo::LUMIVINE).zona == ZonaPlaneta::HABITAVEL, "ordem de ESPECIES");
+static_assert(getEspecie(TipoOrganismo::CRYOMOSS).zona == ZonaPlaneta::PERIFERIA, "ordem de ESPECIES");
+static_assert(getEspecie(TipoOrganismo::HUSKLING).categoria == TipoCategoria::REAGENTE, "ordem de ESPECIES");
+
+// Comportamento comum a todas as espécies de uma categoria. Os laços da
+// Populacao são instanciados por categoria, e os ramos que não se aplicam
+// somem em tempo de compilação (if constexpr).
+template <TipoCategoria C>
+struct TracosCategoria;
+
+template <>
+struct TracosCategoria<TipoCategoria::PLANTA> {
+    static constexpr bool ABSORVE_RECURSOS = true;
+    static constexpr bool SE_MOVE = false;
+    // Reproduções estavam raras demais; cooldown curto mantém o ecossistema vivo
+    static constexpr float COOLDOWN_REPRODUCAO = 10.0f;
+    // Antes eram duas rolagens de 6% por quadro; aqui vai a probabilidade combinada
+    static constexpr float CHANCE_REPRODUCAO = 0.06f * 0.06f;
+};
+
+template <>
+struct TracosCategoria<TipoCategoria::REAGENTE> {
+    static constexpr bool ABSORVE_RECURSOS = false;
+    static constexpr bool SE_MOVE = true;
+    static constexpr float COOLDOWN_REPRODUCAO = 7.5f;
+    static constexpr float CHANCE_REPRODUCAO = 0.08f * 0.08f;
+};
+
+#endif // ESPECIES_HPP
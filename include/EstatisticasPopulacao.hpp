@@ -0,0 +1,58 @@
+#ifndef ESTATISTICAS_POPULACAO_HPP
+#define ESTATISTICAS_POPULACAO_HPP
+
+#include "Organismo.hpp"
+#include <array>
+#include <cstdint>
+
+// Resumo dos organismos vivos de uma população, mantido pela própria
+// Populacao a cada nascimento, morte e envelhecimento, para que as consultas
+// da interface e das missões não precisem percorrer o pool.
+//
+// Contagens e soma das idades são exatas a qualquer momento. A soma e os
+// extremos de energia são refeitos na passada principal do tick (que já lê
+// toda a coluna); entre um tick e outro a soma acompanha nascimentos, mortes
+// e reproduções, e mínimo/máximo ficam com o valor do último tick.
+struct EstatisticasPopulacao {
+    int vivos = 0;
+    std::array<int, NUM_TIPOS_ORGANISMO> porTipo{};
+    std::array<int, NUM_ZONAS> porZona{};
+    std::array<int, 2> porCategoria{};   // indexado por TipoCategoria
+
+    double somaEnergia = 0.0;
+    int64_t somaIdade = 0;
+    float energiaMinima = 0.0f;
+    float energiaMaxima = 0.0f;
+
+    void registrarNascimento(TipoOrganismo tipo, TipoCategoria categoria, ZonaPlaneta zona,
+                             float energia, int idade) {
+        vivos++;
+        porTipo[static_cast<int>(tipo)]++;
+        porZona[static_cast<int>(zona)]++;
+        porCategoria[static_cast<int>(categoria)]++;
+        somaEnergia += energia;
+        somaIdade += idade;
+        if (vivos == 1 || energia < energiaMinima) energiaMinima = energia;
+        if (vivos == 1 || energia > energiaMaxima) energiaMaxima = energia;
+    }
+
+    void registrarMorte(TipoOrganismo tipo, TipoCategoria categoria, ZonaPlaneta zona,
+                        float energia, int idade) {
+        vivos--;
+        porTipo[static_cast<int>(tipo)]--;
+        porZona[static_cast<int>(zona)]--;
+        porCategoria[static_cast<int>(categoria)]--;
+        somaEnergia -= energia;
+        somaIdade -= idade;
+    }
+
+    void registrarEnvelhecimento() { somaIdade++; }
+    void registrarVariacaoEnergia(float delta) { somaEnergia += delta; }
+
+    float energiaMedia() const { return vivos > 0 ? static_cast<float>(somaEnergia / vivos) : 0.0f; }
+    float idadeMedia() const { return vivos > 0 ? static_cast<float>(somaIdade) / vivos : 0.0f; }
+
+    void limpar() { *this = EstatisticasPopulacao{}; }
+};
+
+#endif // ESTATISTICAS_POPULACAO_HPP
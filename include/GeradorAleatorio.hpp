@@ -0,0 +1,49 @@
+#ifndef GERADOR_ALEATORIO_HPP
+#define GERADOR_ALEATORIO_HPP
+
+#include <cstdint>
+
+// Gerador pseudoaleatório baseado em contador (estilo SplitMix64): o n-ésimo
+// número de um fluxo é uma função pura de (semente, fluxo, n). Cada zona tem
+// o seu próprio fluxo, então os sorteios não dependem de quantas threads
+// rodam nem da ordem em que as zonas terminam, e não há estado global
+// compartilhado como no rand().
+class GeradorAleatorio {
+private:
+    static constexpr uint64_t PROPORCAO_AUREA = 0x9E3779B97F4A7C15ULL;
+
+    uint64_t chave;
+    uint64_t contador;
+
+    static uint64_t misturar(uint64_t z) {
+        z = (z ^ (z >> 30)) * 0xBF58476D1CE4E5B9ULL;
+        z = (z ^ (z >> 27)) * 0x94D049BB133111EBULL;
+        return z ^ (z >> 31);
+    }
+
+public:
+    explicit GeradorAleatorio(uint64_t semente = 0, uint64_t fluxo = 0)
+        : chave(misturar(semente ^ misturar(fluxo + PROPORCAO_AUREA))), contador(0) {}
+
+    uint64_t proximo() {
+        return misturar(chave + (++contador) * PROPORCAO_AUREA);
+    }
+
+    // Inteiro uniforme em [0, n)
+    int inteiro(int n) {
+        return static_cast<int>(((proximo() >> 32) * static_cast<uint64_t>(n)) >> 32);
+    }
+
+    // Real uniforme em [0, 1)
+    float uniforme() {
+        return static_cast<float>(proximo() >> 40) * (1.0f / 16777216.0f);
+    }
+
+    bool sortear(float probabilidade) { return uniforme() < probabilidade; }
+
+    // Posição no fluxo (para salvar e retomar uma simulação)
+    uint64_t getContador() const { return contador; }
+    void setContador(uint64_t c) { contador = c; }
+};
+
+#endif // GERADOR_ALEATORIO_HPP
@@ -0,0 +1,44 @@
+#ifndef GERENCIADOR_TEXTURAS_HPP
+#define GERENCIADOR_TEXTURAS_HPP
+
+#include "Organismo.hpp"
+#include <array>
+#include <string>
+#include <raylib.h>
+
+// Registro global de texturas dos organismos, indexado por TipoOrganismo.
+// Cada textura é carregada uma única vez (na primeira aquisição) e só é
+// descarregada quando a última referência é liberada. Organismos e o
+// catálogo guardam apenas o ponteiro devolvido por adquirir().
+class GerenciadorTexturas {
+private:
+    struct Entrada {
+        Texture2D textura;
+        int referencias;
+        bool carregada;
+    };
+
+    std::array<Entrada, NUM_TIPOS_ORGANISMO> entradas;
+
+    GerenciadorTexturas();
+
+public:
+    static GerenciadorTexturas& instancia();
+
+    GerenciadorTexturas(const GerenciadorTexturas&) = delete;
+    GerenciadorTexturas& operator=(const GerenciadorTexturas&) = delete;
+
+    // Incrementa a contagem e devolve a textura (nullptr se o arquivo não existir)
+    const Texture2D* adquirir(TipoOrganismo tipo);
+    void liberar(TipoOrganismo tipo);
+
+    // Consulta sem alterar a contagem de referências
+    const Texture2D* obter(TipoOrganismo tipo) const;
+    int getReferencias(TipoOrganismo tipo) const;
+
+    // Tenta resolver caminhos quando o jogo é executado a partir de bin/ ou da raiz
+    static std::string resolverCaminhoAsset(const std::string& relativo);
+    static const char* getCaminhoTextura(TipoOrganismo tipo);
+};
+
+#endif // GERENCIADOR_TEXTURAS_HPP
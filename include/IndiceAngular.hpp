@@ -0,0 +1,64 @@
+#ifndef INDICE_ANGULAR_HPP
+#define INDICE_ANGULAR_HPP
+
+#include "Organismo.hpp"
+#include <cstdint>
+#include <vector>
+
+// Índice espacial das posições orbitais: o círculo é dividido em setores de
+// mesmo ângulo e cada setor guarda os slots (ver HandleOrganismo) dos
+// organismos que estão nele. Inserção, remoção e troca de setor são O(1);
+// uma consulta de arco só visita os setores que o arco cobre.
+class IndiceAngular {
+public:
+    static constexpr int NUM_SETORES_PADRAO = 128;
+
+private:
+    static constexpr int32_t SEM_SETOR = -1;
+
+    int numSetores;
+    float setoresPorRadiano;
+    std::vector<std::vector<uint32_t>> setores;
+
+    // Por slot: setor atual e posição dentro dele (para remover trocando com o último)
+    std::vector<int32_t> setorDoSlot;
+    std::vector<uint32_t> posicaoNoSetor;
+
+    void retirarDoSetor(uint32_t slot);
+    void colocarNoSetor(uint32_t slot, int setor);
+
+public:
+    explicit IndiceAngular(int numSetores = NUM_SETORES_PADRAO);
+
+    int getNumSetores() const { return numSetores; }
+    int getSetor(float angulo) const;
+
+    void inserir(uint32_t slot, float angulo);
+    void remover(uint32_t slot);
+    // Chamado quando o organismo se move; só mexe nas listas se trocar de setor
+    void atualizar(uint32_t slot, float angulo);
+    void limpar();
+
+    // Visita os slots dos setores que cobrem o arco [centro - meiaAbertura,
+    // centro + meiaAbertura]. São candidatos: quem chama filtra pela posição exata.
+    template <typename Visitante>
+    void visitarArco(float anguloCentro, float meiaAbertura, Visitante&& visitar) const {
+        int total;
+        int primeiro;
+        if (meiaAbertura >= PI_F) {
+            primeiro = 0;
+            total = numSetores;
+        } else {
+            primeiro = getSetor(anguloCentro - meiaAbertura);
+            int ultimo = getSetor(anguloCentro + meiaAbertura);
+            total = (ultimo - primeiro + numSetores) % numSetores + 1;
+        }
+        for (int k = 0; k < total; k++) {
+            for (uint32_t slot : setores[(primeiro + k) % numSetores]) {
+                visitar(slot);
+            }
+        }
+    }
+};
+
+#endif // INDICE_ANGULAR_HPP
@@ -42,6 +42,15 @@ enum class EstadoMissao {
     FALHADA
 };
 
+// Parte de uma Missao que muda durante o jogo (o resto vem do tipo)
+struct ProgressoMissao {
+    EstadoMissao estado;
+    float tempoDecorrido;
+    float tempoCondicao;
+    uint8_t eventoFoiAtivado;
+    uint8_t acaoManualFeita;
+};
+
 class Missao {
 private:
     TipoMissao tipo;
@@ -88,6 +97,10 @@ public:
     
     // Setters
     void setEstado(EstadoMissao e) { estado = e; }
+
+    // Snapshot
+    ProgressoMissao getProgressoInterno() const;
+    void setProgressoInterno(const ProgressoMissao& p);
     
     // Comportamentos
     void iniciar();
@@ -136,6 +149,10 @@ public:
     // Verificação de progressão
     bool todasMissoesCompletas() const;
     bool podeAvancarFase() const;
+
+    // Snapshot: as missões da fase (tipo, zona e progresso) e a atual
+    void salvarEstado(GravadorSnapshot& snapshot, const std::string& prefixo) const;
+    bool carregarEstado(const LeitorSnapshot& snapshot, const std::string& prefixo);
     
 private:
     void criarMissoesFase1();
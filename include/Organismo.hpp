@@ -1,8 +1,8 @@
 #ifndef ORGANISMO_HPP
 #define ORGANISMO_HPP
 
+#include "GeradorAleatorio.hpp"
 #include <string>
-#include <raylib.h>
 
 enum class TipoOrganismo {
     // Núcleo (Zona Vermelha)
@@ -24,6 +24,12 @@ enum class TipoOrganismo {
     HUSKLING
 };
 
+constexpr int NUM_TIPOS_ORGANISMO = 12;
+
+// Constantes angulares do núcleo (o raylib não é visível aqui)
+constexpr float PI_F = 3.14159265358979323846f;
+constexpr float GRAUS_PARA_RAD = PI_F / 180.0f;
+
 enum class TipoCategoria {
     PLANTA,
     REAGENTE
@@ -35,6 +41,20 @@ enum class ZonaPlaneta {
     PERIFERIA    // Zona Azul
 };
 
+constexpr int NUM_ZONAS = 3;
+
+// Quanto cada atributo pode variar numa mutação (o sorteio vai de -0.1 a
+// +0.1 vezes a magnitude)
+struct MagnitudesMutacao {
+    float eficiencia = 0.1f;
+    float resistencia = 0.05f;
+    float velocidade = 0.2f;
+    float energiaMaxima = 10.0f;
+};
+
+// Registro de um organismo individual. É usado para gerar novos organismos
+// (atributos iniciais por espécie + mutação); durante a simulação os dados
+// vivem em colunas no OrganismoPool e o comportamento em Populacao.
 class Organismo {
 private:
     TipoOrganismo tipo;
@@ -49,24 +69,13 @@ private:
     float velocidadeOrbital;
     float eficienciaMetabolica;
     bool vivo;
-    Color cor;
-    float tamanho;
-    Texture2D textura;
-    bool temTextura;
-
 
     // Posição orbital
     float anguloOrbital;
     float raioOrbital;
     
-    
-    // Reprodução
-    int ciclosVida;
-    int ciclosReproducao;
-    
 public:
     Organismo(TipoOrganismo t, ZonaPlaneta z, float angulo, float raio);
-    ~Organismo();
     
     // Getters
     TipoOrganismo getTipo() const { return tipo; }
@@ -81,8 +90,6 @@ public:
     bool isVivo() const { return vivo; }
     float getAnguloOrbital() const { return anguloOrbital; }
     float getRaioOrbital() const { return raioOrbital; }
-    Color getCor() const { return cor; }
-    float getTamanho() const { return tamanho; }
     
     // Setters
     void setEnergia(float e);
@@ -90,25 +97,12 @@ public:
     void setAnguloOrbital(float a) { anguloOrbital = a; }
     
     // Comportamentos
-    void atualizar(float deltaTime, float temperaturaZona, float recursosZona);
-    void consumirEnergia(float quantidade);
-    void envelhecer();
-    bool podeReproduzir() const;
-    Organismo* reproduzir();
-    void aplicarMutacao();
-    void mover(float deltaTime);
-    
-    // Renderização
-    void desenhar(Vector2 centroTela) const;
-    
-    // Utilidades
-    std::string getNome() const;
-    std::string getDescricao() const;
+    void aplicarMutacao(GeradorAleatorio& gerador, const MagnitudesMutacao& magnitudes = MagnitudesMutacao());
+
+    // Dados fixos da espécie: ver getEspecie (Especies.hpp)
     
 private:
     void inicializarAtributos();
-    void atualizarAparencia();
-    Color getCorPorTipo() const;
 };
 
 #endif // ORGANISMO_HPP
\ No newline at end of file
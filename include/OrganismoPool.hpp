@@ -0,0 +1,112 @@
+#ifndef ORGANISMO_POOL_HPP
+#define ORGANISMO_POOL_HPP
+
+#include "Organismo.hpp"
+#include "Snapshot.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Referência a um organismo do pool, resolvida em O(1). Continua apontando
+// para o mesmo organismo enquanto ele existir, mesmo quando a compactação
+// move sua linha. O slot é reaproveitado por outros organismos depois da
+// morte; a geração distingue os donos, então um handle antigo deixa de ser
+// aceito em vez de apontar para outro organismo.
+struct HandleOrganismo {
+    static constexpr uint32_t SLOT_INVALIDO = 0xFFFFFFFFu;
+
+    uint32_t slot = SLOT_INVALIDO;
+    uint32_t geracao = 0;
+
+    bool valido() const { return slot != SLOT_INVALIDO; }
+    bool operator==(const HandleOrganismo& o) const { return slot == o.slot && geracao == o.geracao; }
+    bool operator!=(const HandleOrganismo& o) const { return !(*this == o); }
+};
+
+// Identificador permanente de um organismo: nunca é reaproveitado, nem entre
+// zonas (os 8 bits altos guardam a zona) nem quando o pool é esvaziado, e
+// continua válido depois da morte. Serve para registros que duram mais que
+// o organismo (linhagem, telemetria, replay).
+using IdOrganismo = uint64_t;
+constexpr IdOrganismo ID_INVALIDO = 0;
+
+inline ZonaPlaneta getZonaDoId(IdOrganismo id) { return static_cast<ZonaPlaneta>((id >> 56) - 1); }
+inline uint64_t getSequencialDoId(IdOrganismo id) { return id & 0x00FFFFFFFFFFFFFFULL; }
+
+// Armazenamento dos organismos de uma população em estrutura-de-arrays:
+// cada atributo vive num vetor contíguo e a linha i de todas as colunas
+// descreve o mesmo organismo. As passadas da simulação percorrem apenas as
+// colunas de que precisam, em ordem linear.
+class OrganismoPool {
+public:
+    // Colunas quentes (lidas/escritas em toda atualização)
+    std::vector<float> energia;
+    std::vector<float> energiaMaxima;
+    std::vector<float> resistenciaTermica;
+    std::vector<float> eficienciaMetabolica;
+    std::vector<float> velocidadeOrbital;
+    std::vector<float> anguloOrbital;
+    std::vector<uint8_t> vivo;
+    std::vector<TipoCategoria> categoria;
+
+    // Colunas frias
+    std::vector<TipoOrganismo> tipo;
+    std::vector<ZonaPlaneta> zona;
+    std::vector<float> raioOrbital;
+    std::vector<int> idade;
+
+    // 1 quando o cooldown de reprodução venceu (ver RodaTemporal em Populacao)
+    std::vector<uint8_t> aptoReproducao;
+
+    // Ângulo no início do tick atual, para a interpolação da renderização
+    std::vector<float> anguloAnterior;
+
+    std::vector<IdOrganismo> id;
+
+    // Aparência não é guardada: a camada gráfica a deriva da energia ao
+    // desenhar (ver RenderizadorOrganismos)
+
+private:
+    // Tabela de indireção dos handles: slot -> linha e linha -> slot
+    std::vector<uint32_t> linhaDoSlot;
+    std::vector<uint32_t> geracaoDoSlot;
+    std::vector<uint32_t> slotDaLinha;
+    std::vector<uint32_t> slotsLivres;
+
+    // Sequencial dos IDs emitidos por este pool
+    uint64_t ultimoId = 0;
+
+    void moverLinha(size_t destino, size_t origem);
+
+public:
+    OrganismoPool() = default;
+
+    size_t quantidade() const { return tipo.size(); }
+    bool vazio() const { return tipo.empty(); }
+    // Com a capacidade reservada, nascimentos e mortes reaproveitam a memória
+    // das colunas e os slots liberados sem voltar ao heap
+    void reservar(size_t capacidade);
+
+    // Acrescenta uma linha com os atributos do organismo e lhe dá um ID novo
+    HandleOrganismo inserir(const Organismo& org);
+
+    // Remove as linhas mortas trazendo a última linha para o buraco (a ordem
+    // das linhas não é preservada); devolve quantas saíram
+    size_t removerMortos();
+    void limpar();
+
+    // Snapshot: uma seção por coluna, com o nome prefixado. Ao carregar,
+    // recusa organismos de outra zona ou com tipo/categoria fora das tabelas.
+    void salvarEstado(GravadorSnapshot& snapshot, const std::string& prefixo) const;
+    bool carregarEstado(const LeitorSnapshot& snapshot, const std::string& prefixo, ZonaPlaneta zonaPool);
+
+    // Handles
+    HandleOrganismo getHandle(size_t linha) const {
+        uint32_t slot = slotDaLinha[linha];
+        return HandleOrganismo{slot, geracaoDoSlot[slot]};
+    }
+    bool contem(HandleOrganismo h) const;
+    size_t getLinha(HandleOrganismo h) const { return linhaDoSlot[h.slot]; }
+};
+
+#endif // ORGANISMO_POOL_HPP
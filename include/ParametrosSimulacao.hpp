@@ -0,0 +1,62 @@
+#ifndef PARAMETROS_SIMULACAO_HPP
+#define PARAMETROS_SIMULACAO_HPP
+
+#include "Organismo.hpp"
+#include "Ambiente.hpp"
+#include "Especies.hpp"
+#include <string>
+#include <vector>
+
+// Chance (por tick a 60 Hz) e cooldown (s) de reprodução, indexados por
+// TipoCategoria
+struct ParametrosReproducao {
+    float chance[2] = {
+        TracosCategoria<TipoCategoria::PLANTA>::CHANCE_REPRODUCAO,
+        TracosCategoria<TipoCategoria::REAGENTE>::CHANCE_REPRODUCAO
+    };
+    float cooldown[2] = {
+        TracosCategoria<TipoCategoria::PLANTA>::COOLDOWN_REPRODUCAO,
+        TracosCategoria<TipoCategoria::REAGENTE>::COOLDOWN_REPRODUCAO
+    };
+};
+
+// Frequência (Hz de simulação) de cada subsistema. O tick base continua
+// sendo a taxa de tick; cada subsistema roda a cada round(taxa / frequência)
+// ticks e recebe o tempo decorrido desde a sua última execução. Acima da
+// taxa de tick o subsistema roda em todo tick.
+struct FrequenciasSubsistemas {
+    float ambiente = 10.0f;   // eventos e condições das zonas
+    float biologia = 30.0f;   // organismos (energia, órbita, reprodução...)
+    float missoes = 4.0f;     // missões, fases e vida do supercomputador
+};
+
+// Constantes de calibragem da simulação. O padrão reproduz o jogo; as
+// ferramentas sem janela (observador_sweep) variam os campos pelo nome.
+struct ParametrosSimulacao {
+    static constexpr int POPULACAO_MAXIMA_ZONA_PADRAO = 60;
+
+    CondicoesZona zonas[NUM_ZONAS];
+    ParametrosReproducao reproducao;
+    MagnitudesMutacao mutacao;
+    // Teto de organismos em cada zona; nascimentos além dele não acontecem.
+    // Float como os demais campos, arredondado ao aplicar.
+    float populacaoMaximaZona = POPULACAO_MAXIMA_ZONA_PADRAO;
+
+    ParametrosSimulacao();
+
+    // Campo pelo nome, ou nulo se o nome não existir. Nomes:
+    //   <ZONA>.temperaturaBase, <ZONA>.nivelRecursosBase, <ZONA>.taxaConsumo
+    //   <CATEGORIA>.chanceReproducao, <CATEGORIA>.cooldownReproducao
+    //   mutacao.eficiencia, mutacao.resistencia, mutacao.velocidade,
+    //   mutacao.energiaMaxima, zona.populacaoMaxima
+    // com ZONA = NUCLEO/HABITAVEL/PERIFERIA e CATEGORIA = PLANTA/REAGENTE.
+    // taxaConsumo escala o consumo base de energia dos organismos em
+    // proporção à taxa padrão da zona (ver Ambiente::getFatorConsumo).
+    // Cooldowns abaixo de Simulacao::PASSO_RAPIDO encurtam o passo rápido
+    // para o menor deles (mais passos, mesma fidelidade).
+    float* localizar(const std::string& nome);
+
+    static std::vector<std::string> getNomes();
+};
+
+#endif // PARAMETROS_SIMULACAO_HPP
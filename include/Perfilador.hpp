@@ -0,0 +1,135 @@
+#ifndef PERFILADOR_HPP
+#define PERFILADOR_HPP
+
+#include <atomic>
+#include <chrono>
+#include <cstdint>
+#include <vector>
+
+// Trechos medidos. A ordem é a da tabela do overlay; os agregados
+// (SIMULACAO, RENDERIZACAO, RENDER_JOGO) incluem os trechos abaixo deles.
+enum class SecaoPerfil {
+    ENTRADA,
+    SIMULACAO,
+    AMBIENTE,
+    ORGANISMOS,
+    TEMPORIZADORES,
+    SELECAO_NATURAL,
+    REPRODUCAO,
+    REMOCAO_MORTOS,
+    MISSOES,
+    AUTOSALVAMENTO,
+    TEXTURAS,
+    RENDERIZACAO,
+    RENDER_ESTRELAS,
+    RENDER_INTERFACE_PC,
+    RENDER_TELA_INICIAL,
+    RENDER_JOGO,
+    RENDER_PLANETA,
+    RENDER_ORGANISMOS,
+    RENDER_INSPECAO,
+    RENDER_INTERFACE,
+    RENDER_MENU_EVENTOS,
+    RENDER_MENU_MISSOES,
+    RENDER_CATALOGO,
+    RENDER_GAME_OVER,
+    RENDER_FINAL,
+    NUM_SECOES
+};
+
+constexpr int NUM_SECOES_PERFIL = static_cast<int>(SecaoPerfil::NUM_SECOES);
+
+// Tempos por quadro de cada trecho, com percentis sobre os últimos JANELA
+// quadros. Os cronômetros somam em acumuladores atômicos (as zonas rodam em
+// threads do PoolTrabalho); fecharQuadro(), na thread principal e fora da
+// simulação, move as somas para o histórico.
+//
+// Desligado (padrão), um CronometroEscopo custa uma leitura atômica.
+class Perfilador {
+public:
+    static constexpr int JANELA = 240;
+
+    struct Percentis {
+        float ultimo = 0, p50 = 0, p95 = 0, p99 = 0;   // ms
+    };
+
+    // Quadro que passou de LIMIAR_PICO vezes a mediana: o que pesou nele
+    static constexpr float LIMIAR_PICO = 2.0f;
+    struct Pico {
+        uint64_t quadro = 0;
+        float quadroMs = 0;
+        float secoesMs[NUM_SECOES_PERFIL] = {};
+    };
+
+private:
+    std::atomic<bool> ativo;
+    std::atomic<uint64_t> acumulado[NUM_SECOES_PERFIL];   // ns no quadro atual
+
+    // Histórico circular em ms; a última linha é o tempo do quadro inteiro
+    float historico[NUM_SECOES_PERFIL + 1][JANELA];
+    int posicao;
+    int preenchidos;
+    uint64_t totalQuadros;
+    Pico ultimoPico;
+    bool temPico;
+
+    Perfilador();
+
+public:
+    static Perfilador& instancia();
+
+    Perfilador(const Perfilador&) = delete;
+    Perfilador& operator=(const Perfilador&) = delete;
+
+    void setAtivo(bool a) { ativo.store(a, std::memory_order_relaxed); }
+    bool isAtivo() const { return ativo.load(std::memory_order_relaxed); }
+
+    void adicionar(SecaoPerfil secao, uint64_t nanossegundos) {
+        acumulado[static_cast<int>(secao)].fetch_add(nanossegundos, std::memory_order_relaxed);
+    }
+
+    // Fecha o quadro de `segundosQuadro` (do início de um ao do outro)
+    void fecharQuadro(float segundosQuadro);
+    void limpar();
+
+    Percentis getPercentis(SecaoPerfil secao) const;
+    Percentis getPercentisQuadro() const;
+    // Tempos de quadro (ms) do mais antigo ao mais recente
+    void copiarHistoricoQuadro(std::vector<float>& destino) const;
+    const Pico* getUltimoPico() const { return temPico ? &ultimoPico : nullptr; }
+    uint64_t getTotalQuadros() const { return totalQuadros; }
+
+    static const char* getNome(SecaoPerfil secao);
+    // Profundidade na tabela (0 = topo); agregados têm filhos no nível seguinte
+    static int getNivel(SecaoPerfil secao);
+    static bool isAgregado(SecaoPerfil secao);
+
+private:
+    Percentis calcularPercentis(int linha) const;
+};
+
+// Soma ao Perfilador o tempo entre a construção e a destruição
+class CronometroEscopo {
+private:
+    SecaoPerfil secao;
+    bool ativo;
+    std::chrono::steady_clock::time_point inicio;
+
+public:
+    explicit CronometroEscopo(SecaoPerfil s)
+        : secao(s), ativo(Perfilador::instancia().isAtivo()) {
+        if (ativo) inicio = std::chrono::steady_clock::now();
+    }
+
+    ~CronometroEscopo() {
+        if (!ativo) return;
+        auto duracao = std::chrono::steady_clock::now() - inicio;
+        Perfilador::instancia().adicionar(
+            secao, static_cast<uint64_t>(std::chrono::duration_cast<std::chrono::nanoseconds>(duracao).count()));
+    }
+
+    CronometroEscopo(const CronometroEscopo&) = delete;
+    CronometroEscopo& operator=(const CronometroEscopo&) = delete;
+};
+
+#endif // PERFILADOR_HPP
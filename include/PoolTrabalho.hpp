@@ -0,0 +1,48 @@
+#ifndef POOL_TRABALHO_HPP
+#define POOL_TRABALHO_HPP
+
+#include <atomic>
+#include <condition_variable>
+#include <cstdint>
+#include <functional>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Conjunto fixo de threads para paralelizar laços curtos dentro de um tick.
+// executar(n, tarefa) chama tarefa(0..n-1) distribuindo os índices entre as
+// threads do pool e a thread chamadora, e só retorna quando todos terminaram.
+class PoolTrabalho {
+private:
+    std::vector<std::thread> threads;
+
+    std::mutex mutex;
+    std::condition_variable cvInicio;
+    std::condition_variable cvFim;
+
+    // Lote atual. Cada lote só termina quando todas as threads passaram por
+    // ele (pendentes == 0), então nenhuma thread enxerga um lote antigo.
+    const std::function<void(int)>* tarefa;
+    int totalIndices;
+    std::atomic<int> proximoIndice;
+    int pendentes;
+    uint64_t lote;
+    bool encerrando;
+
+    void lacoTrabalhador();
+    void consumirIndices();
+
+public:
+    // numThreads: threads auxiliares (a chamadora também trabalha)
+    explicit PoolTrabalho(int numThreads);
+    ~PoolTrabalho();
+
+    PoolTrabalho(const PoolTrabalho&) = delete;
+    PoolTrabalho& operator=(const PoolTrabalho&) = delete;
+
+    void executar(int n, const std::function<void(int)>& tarefa);
+
+    int getNumThreads() const { return static_cast<int>(threads.size()); }
+};
+
+#endif // POOL_TRABALHO_HPP
@@ -2,16 +2,41 @@
 #define POPULACAO_HPP
 
 #include "Organismo.hpp"
+#include "OrganismoPool.hpp"
 #include "Ambiente.hpp"
+#include "EstatisticasPopulacao.hpp"
+#include "IndiceAngular.hpp"
+#include "RodaTemporal.hpp"
+#include "RegistroLinhagem.hpp"
+#include "ParametrosSimulacao.hpp"
 #include <vector>
-#include <memory>
 
 class Populacao {
 private:
-    std::vector<std::unique_ptr<Organismo>> organismos;
-    std::vector<std::unique_ptr<Organismo>> novaGeracao;
+    OrganismoPool organismos;
+
+    // Organismos vivos por setor angular (consultas de vizinhança)
+    IndiceAngular indice;
+
+    // Temporizadores por organismo (envelhecimento, fim do cooldown de
+    // reprodução): o tick só paga pelos que vencem, não por organismo vivo
+    RodaTemporal roda;
+    double tempoSimulado;
+    std::vector<Temporizador> aptosReproducao;   // cooldowns já vencidos
+
+    // Nascimentos do tick para o RegistroLinhagem (ver Simulacao)
+    bool anotarNascimentos;
+    std::vector<Nascimento> nascimentosPendentes;
+
+    // Fluxo aleatório próprio da zona (ver GeradorAleatorio)
+    GeradorAleatorio gerador;
+
+    // Calibragem (injetada pela Simulacao; ver ParametrosSimulacao)
+    ParametrosReproducao reproducao;
+    MagnitudesMutacao mutacao;
     
     // Estatísticas
+    EstatisticasPopulacao estatisticas;
     int totalNascimentos;
     int totalMortes;
     int geracao;
@@ -24,38 +49,80 @@ public:
     ~Populacao();
     
     // Gestão de organismos
-    void adicionarOrganismo(TipoOrganismo tipo, ZonaPlaneta zona, float angulo, float raio);
+    HandleOrganismo adicionarOrganismo(TipoOrganismo tipo, ZonaPlaneta zona, float angulo, float raio);
     void removerMortos();
-    void processarReproducao();
-    void aplicarSelecaoNatural(const Ambiente& ambiente);
+    void processarReproducao(float deltaTime);
+    void aplicarSelecaoNatural(const Ambiente& ambiente, float deltaTime);
     
     // Atualização
     void atualizar(float deltaTime, const Ambiente& ambiente);
     
     // Getters
-    int getTamanho() const { return organismos.size(); }
+    int getTamanho() const { return static_cast<int>(organismos.quantidade()); }
     int getTotalNascimentos() const { return totalNascimentos; }
     int getTotalMortes() const { return totalMortes; }
     int getGeracao() const { return geracao; }
-    const std::vector<std::unique_ptr<Organismo>>& getOrganismos() const { return organismos; }
+    const OrganismoPool& getOrganismos() const { return organismos; }
+
+    // Fonte de aleatoriedade (injetada pela Simulacao a partir da semente)
+    void setGerador(const GeradorAleatorio& g) { gerador = g; }
+    const GeradorAleatorio& getGerador() const { return gerador; }
+
+    // Calibragem da reprodução e da mutação. Antes de inicializarPopulacao:
+    // os cooldowns já agendados não mudam.
+    void setParametros(const ParametrosReproducao& r, const MagnitudesMutacao& m) { reproducao = r; mutacao = m; }
+    void setPopulacaoMaxima(int maxima);
+    int getPopulacaoMaxima() const { return populacaoMaxima; }
+
+    // Genealogia: quando ligado, cada nascimento é anotado até a Simulacao
+    // recolhê-lo para o RegistroLinhagem
+    void setAnotarNascimentos(bool anotar) { anotarNascimentos = anotar; }
+    std::vector<Nascimento>& getNascimentosPendentes() { return nascimentosPendentes; }
     
-    // Estatísticas
+    // Estatísticas (O(1), lidas de EstatisticasPopulacao)
+    const EstatisticasPopulacao& getEstatisticas() const { return estatisticas; }
     int contarPorZona(ZonaPlaneta zona) const;
     int contarPorTipo(TipoOrganismo tipo) const;
     float energiaMedia() const;
     float idadeMedia() const;
+
+    // Vizinhança, via IndiceAngular: linhas dos organismos vivos a até
+    // `distancia` do ponto polar (angulo, raio)...
+    void buscarVizinhos(float angulo, float raio, float distancia, std::vector<size_t>& linhas) const;
+    // ...ou dentro do setor anular [anguloInicio, anguloFim] x [raioMin, raioMax]
+    void buscarNoArco(float anguloInicio, float anguloFim, float raioMin, float raioMax,
+                      std::vector<size_t>& linhas) const;
     
     // Inicialização
     void inicializarPopulacao(ZonaPlaneta zona, int quantidade);
     void limpar();
-    void removerAleatorios(int quantidade);
-    
-    // Renderização
-    void desenhar(Vector2 centroTela) const;
 
+    // Snapshot. O gerador precisa estar com a chave da zona (setGerador)
+    // antes de carregar: só a posição no fluxo vai no arquivo.
+    void salvarEstado(GravadorSnapshot& snapshot, const std::string& prefixo) const;
+    bool carregarEstado(const LeitorSnapshot& snapshot, const std::string& prefixo, ZonaPlaneta zona);
+    void removerAleatorios(int quantidade);
     
 private:
-    TipoOrganismo getOrganismoAleatorio(ZonaPlaneta zona) const;
+    TipoOrganismo getOrganismoAleatorio(ZonaPlaneta zona);
+
+    // Únicos pontos de entrada e saída de organismos (mantêm as estatísticas)
+    HandleOrganismo inserirOrganismo(const Organismo& org, IdOrganismo idPai = ID_INVALIDO);
+    void morrer(size_t i);
+
+    // RodaTemporal
+    void processarTemporizadores(float deltaTime);
+    void dispararTemporizador(const Temporizador& t);
+    void agendarFimCooldown(HandleOrganismo h, TipoCategoria categoria);
+
+    // Passadas sobre as colunas do pool
+    void atualizarOrganismos(float deltaTime, float temperaturaZona, float recursosZona, float fatorConsumo);
+    // Energia e movimento de um organismo vivo; devolve a nova energia
+    template <TipoCategoria C>
+    float atualizarOrganismo(size_t i, float deltaTime, float temperaturaZona, float recursosZona, float fatorConsumo);
+    void envelhecer(size_t i);
+    bool podeReproduzir(size_t i, float deltaTime);
+    void reproduzir(size_t i);
 };
 
 #endif // POPULACAO_HPP
\ No newline at end of file
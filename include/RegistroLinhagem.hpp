@@ -0,0 +1,99 @@
+#ifndef REGISTRO_LINHAGEM_HPP
+#define REGISTRO_LINHAGEM_HPP
+
+#include "Organismo.hpp"
+#include "OrganismoPool.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Um nascimento ainda não registrado: a Populacao o anota durante o tick
+// (possivelmente em paralelo com as outras zonas) e a Simulacao o passa ao
+// RegistroLinhagem depois, na ordem das zonas.
+struct Nascimento {
+    IdOrganismo id;
+    IdOrganismo idPai;   // ID_INVALIDO para quem não nasceu de reprodução
+    TipoOrganismo tipo;
+
+    // Desvio dos atributos em relação à espécie (mutação), quantizado
+    int16_t deltaEficiencia;
+    int16_t deltaResistencia;
+    int16_t deltaVelocidade;
+    int16_t deltaEnergiaMaxima;
+};
+
+// Genealogia de todos os organismos de uma partida, só de acréscimo, em
+// colunas (29 bytes por nascimento). Guarda quem é o pai, o tick do
+// nascimento e o quanto a mutação afastou cada atributo dos valores da
+// espécie, para estudar a adaptação depois de eventos.
+//
+// Pode ser gravado em disco durante a partida: a cada TAMANHO_BLOCO
+// nascimentos as colunas vão para o arquivo como um bloco e a memória é
+// reaproveitada. carregar() lê o arquivo inteiro de volta para análise; se
+// a execução foi interrompida no meio de um bloco, fica com os completos.
+class RegistroLinhagem {
+public:
+    static constexpr size_t TAMANHO_BLOCO = 65536;
+    static constexpr size_t NAO_ENCONTRADO = static_cast<size_t>(-1);
+
+    // Quantização dos desvios: atributos em 0..1 e energia máxima
+    static constexpr float ESCALA_DELTA_ATRIBUTO = 1e-4f;
+    static constexpr float ESCALA_DELTA_ENERGIA = 1e-2f;
+
+    // Colunas (linha i = i-ésimo nascimento em memória)
+    std::vector<IdOrganismo> id;
+    std::vector<IdOrganismo> idPai;
+    std::vector<uint32_t> tickNascimento;
+    std::vector<uint8_t> tipo;
+    std::vector<int16_t> deltaEficiencia;
+    std::vector<int16_t> deltaResistencia;
+    std::vector<int16_t> deltaVelocidade;
+    std::vector<int16_t> deltaEnergiaMaxima;
+
+private:
+    // Linha de cada ID em memória, por zona, indexada pelo sequencial do ID
+    // (o pool emite sequenciais densos e todo organismo passa por aqui)
+    std::vector<uint32_t> linhaDoSequencial[NUM_ZONAS];
+
+    std::ofstream arquivo;
+    uint64_t totalRegistrado;
+
+    void indexar(size_t linha);
+    bool gravarBloco();
+
+public:
+    RegistroLinhagem();
+    ~RegistroLinhagem();
+
+    RegistroLinhagem(const RegistroLinhagem&) = delete;
+    RegistroLinhagem& operator=(const RegistroLinhagem&) = delete;
+
+    // Monta o registro pendente de um organismo recém-criado
+    static Nascimento descreverNascimento(const Organismo& org, IdOrganismo id, IdOrganismo idPai);
+
+    void registrar(const Nascimento& n, uint32_t tick);
+
+    size_t quantidade() const { return id.size(); }
+    uint64_t getTotalRegistrado() const { return totalRegistrado; }
+    void limpar();
+
+    // Gravação contínua. Sem arquivo aberto, tudo fica em memória.
+    bool abrirArquivo(const std::string& caminho);
+    bool arquivoAberto() const { return arquivo.is_open(); }
+    void fecharArquivo();   // grava o bloco pendente antes de fechar
+
+    // Substitui o conteúdo pelo de um arquivo gravado; false se inválido
+    bool carregar(const std::string& caminho);
+
+    // Consultas sobre o que está em memória
+    size_t buscar(IdOrganismo idOrganismo) const;
+    // Cadeia de ancestrais conhecidos, do pai até o fundador
+    void getAncestrais(IdOrganismo idOrganismo, std::vector<IdOrganismo>& ancestrais) const;
+
+    static float desquantizarAtributo(int16_t delta) { return delta * ESCALA_DELTA_ATRIBUTO; }
+    static float desquantizarEnergia(int16_t delta) { return delta * ESCALA_DELTA_ENERGIA; }
+};
+
+#endif // REGISTRO_LINHAGEM_HPP
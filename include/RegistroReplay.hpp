@@ -0,0 +1,91 @@
+#ifndef REGISTRO_REPLAY_HPP
+#define REGISTRO_REPLAY_HPP
+
+#include "ParametrosSimulacao.hpp"
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <vector>
+
+// Tudo o que entra na simulação de fora dela. A Simulacao anota cada um com
+// o tick em que foi aplicado (antes do tick seguinte).
+enum class TipoComando : uint8_t {
+    ATIVAR_EVENTO,          // zona, codigo = TipoEvento, valor = duração
+    REDUZIR_TEMPO_EVENTO,   // zona, valor = segundos
+    CANCELAR_EVENTOS,
+    ACAO_MANUAL,            // codigo = TipoMissao
+    REPARAR,                // valor = quantidade
+    PASSO_RAPIDO,           // o avanço a partir deste tick foi um passoRapido()
+    TAXA_TICK,              // valor = ticks por segundo
+    VELOCIDADE,             // valor = multiplicador da tela (só informativo)
+    FIM                     // encerra o arquivo (ver RegistroReplay)
+};
+
+struct ComandoReplay {
+    uint64_t tick = 0;
+    TipoComando tipo = TipoComando::FIM;
+    uint8_t zona = 0;
+    uint8_t codigo = 0;
+    float valor = 0;
+};
+
+// Gravação compacta de uma partida: semente, configuração da Simulacao e a
+// sequência de comandos. Com a mesma semente e os mesmos comandos nos mesmos
+// ticks a simulação é bit a bit a mesma, então o arquivo basta para rever
+// uma partida (observador_replay) ou reproduzir um bug.
+//
+// Formato (ordem de bytes da máquina que gravou):
+//   cabeçalho: "OBRP" + uint32 versão + uint64 semente + float taxa de tick
+//              + 3 float frequências (ambiente, biologia, missões)
+//              + uint32 n + n float (ParametrosSimulacao::getNomes, em ordem)
+//   comandos:  delta de tick (varint) + tipo + zona + codigo + float valor
+//   fim:       delta de tick (varint) + FIM + uint64 checksum do estado
+// Sem o registro FIM (partida interrompida) o arquivo ainda é válido, só
+// não há o que conferir no final.
+class RegistroReplay {
+private:
+    uint64_t semente;
+    float taxaTick;
+    FrequenciasSubsistemas frequencias;
+    ParametrosSimulacao parametros;
+    std::vector<ComandoReplay> comandos;
+
+    bool encerrado;
+    uint64_t tickFinal;
+    uint64_t checksumFinal;
+
+    std::ofstream arquivo;
+    uint64_t ultimoTickGravado;
+
+    void gravarTick(uint64_t tick);
+
+public:
+    RegistroReplay();
+    ~RegistroReplay();
+
+    RegistroReplay(const RegistroReplay&) = delete;
+    RegistroReplay& operator=(const RegistroReplay&) = delete;
+
+    // Gravação: cada comando vai direto para o disco, para sobreviver a
+    // uma queda do jogo
+    bool abrir(const std::string& caminho, uint64_t semente, float taxaTick,
+               const FrequenciasSubsistemas& frequencias, const ParametrosSimulacao& parametros);
+    bool gravando() const { return arquivo.is_open(); }
+    void registrar(const ComandoReplay& c);
+    void encerrar(uint64_t tick, uint64_t checksum);
+
+    // Leitura; false (com o motivo em `erro`) se o arquivo for inválido
+    bool carregar(const std::string& caminho, std::string& erro);
+
+    uint64_t getSemente() const { return semente; }
+    float getTaxaTick() const { return taxaTick; }
+    const FrequenciasSubsistemas& getFrequencias() const { return frequencias; }
+    const ParametrosSimulacao& getParametros() const { return parametros; }
+    const std::vector<ComandoReplay>& getComandos() const { return comandos; }
+
+    bool estaEncerrado() const { return encerrado; }
+    uint64_t getTickFinal() const { return tickFinal; }
+    uint64_t getChecksumFinal() const { return checksumFinal; }
+};
+
+#endif // REGISTRO_REPLAY_HPP
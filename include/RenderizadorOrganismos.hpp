@@ -0,0 +1,27 @@
+#ifndef RENDERIZADOR_ORGANISMOS_HPP
+#define RENDERIZADOR_ORGANISMOS_HPP
+
+#include "Organismo.hpp"
+#include "Populacao.hpp"
+#include <raylib.h>
+
+// Camada gráfica dos organismos: traduz o estado da simulação (sem tipos
+// do raylib) em cores, texturas e efeitos na tela. A aparência (tamanho,
+// cor, transparência) é derivada aqui, só para quem é desenhado; o tick da
+// simulação não calcula nada visual.
+class RenderizadorOrganismos {
+public:
+    // alpha: fração do próximo tick já decorrida (0..1), usada para
+    // interpolar a posição entre o estado anterior e o atual
+    static void desenharPopulacao(const Populacao& populacao, Vector2 centroTela, float alpha);
+    static void desenharOrganismo(TipoOrganismo tipo, Vector2 posicao, float tamanho, Color cor);
+
+    static Color getCorPorTipo(TipoOrganismo tipo);
+
+    // Aparência derivada da energia
+    static float calcularTamanho(float energia, float energiaMaxima);
+    static float calcularOpacidade(float energia, float energiaMaxima);
+    static Color getCorZona(ZonaPlaneta zona);
+};
+
+#endif // RENDERIZADOR_ORGANISMOS_HPP
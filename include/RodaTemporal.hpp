@@ -0,0 +1,94 @@
+#ifndef RODA_TEMPORAL_HPP
+#define RODA_TEMPORAL_HPP
+
+#include "Snapshot.hpp"
+#include <array>
+#include <cstddef>
+#include <cstdint>
+#include <vector>
+
+// Temporizador agendado na RodaTemporal. `alvo`/`geracao` identificam o
+// organismo (slot e geração de um HandleOrganismo); quem recebe o disparo confere
+// se ele ainda existe, então cancelar é só deixar o disparo cair.
+//
+// Vai byte a byte para o snapshot, então o enchimento é explícito e zerado:
+// sem ele, lixo de pilha iria para o arquivo e os deltas do salvamento
+// automático veriam páginas mudadas que não mudaram.
+struct Temporizador {
+    uint64_t prazo;
+    uint32_t alvo;
+    uint32_t geracao;
+    uint8_t tipo;
+    uint8_t reservado[7] = {};
+};
+static_assert(sizeof(Temporizador) == 24, "Temporizador não pode ter enchimento implícito");
+
+// Roda de tempo hierárquica (estilo Varghese/Lauck). Quatro níveis de
+// 256/64/64/64 posições cobrem ~2^26 passos à frente; o que passar disso
+// fica numa lista de espera. Agendar é O(1) e avançar um passo só toca os
+// temporizadores que vencem nele (mais, de vez em quando, a descida de uma
+// posição de nível superior para os níveis de baixo).
+class RodaTemporal {
+private:
+    static constexpr int BITS_NIVEL0 = 8;
+    static constexpr int BITS_NIVEL = 6;
+    static constexpr int NUM_NIVEIS = 4;
+    static constexpr uint64_t TAMANHO_NIVEL0 = 1ull << BITS_NIVEL0;
+    static constexpr uint64_t TAMANHO_NIVEL = 1ull << BITS_NIVEL;
+
+    std::array<std::vector<Temporizador>, TAMANHO_NIVEL0> nivel0;
+    std::array<std::array<std::vector<Temporizador>, TAMANHO_NIVEL>, NUM_NIVEIS - 1> niveis;
+    std::vector<Temporizador> espera;
+
+    uint64_t agora;
+    size_t pendentes;
+
+    // Reaproveitado a cada passo para não alocar
+    std::vector<Temporizador> vencendo;
+
+    void inserir(const Temporizador& t);
+    void descer(std::vector<Temporizador>& posicao);
+
+public:
+    RodaTemporal();
+
+    uint64_t getAgora() const { return agora; }
+    size_t getPendentes() const { return pendentes; }
+
+    // prazo <= agora dispara no próximo avanço
+    void agendar(uint64_t prazo, uint32_t alvo, uint32_t geracao, uint8_t tipo);
+    void limpar();
+
+    // Snapshot: guarda cada posição na ordem em que está, para que os
+    // disparos de um mesmo passo sigam na mesma ordem depois de carregar
+    void salvarEstado(GravadorSnapshot& snapshot, const std::string& prefixo) const;
+    bool carregarEstado(const LeitorSnapshot& snapshot, const std::string& prefixo);
+
+    // Avança um passo e chama disparar(t) para cada temporizador que vence nele.
+    // disparar pode agendar novos temporizadores.
+    template <typename Disparar>
+    void avancar(Disparar&& disparar) {
+        agora++;
+
+        // Virada de um nível: traz a próxima posição do nível de cima para baixo
+        uint64_t mascara = TAMANHO_NIVEL0 - 1;
+        int deslocamento = BITS_NIVEL0;
+        for (int n = 0; n < NUM_NIVEIS - 1 && (agora & mascara) == 0; n++) {
+            descer(niveis[n][(agora >> deslocamento) & (TAMANHO_NIVEL - 1)]);
+            mascara = (mascara << BITS_NIVEL) | (TAMANHO_NIVEL - 1);
+            deslocamento += BITS_NIVEL;
+        }
+        if ((agora & mascara) == 0 && !espera.empty()) {
+            descer(espera);
+        }
+
+        vencendo.clear();
+        vencendo.swap(nivel0[agora & (TAMANHO_NIVEL0 - 1)]);
+        pendentes -= vencendo.size();
+        for (const Temporizador& t : vencendo) {
+            disparar(t);
+        }
+    }
+};
+
+#endif // RODA_TEMPORAL_HPP
@@ -0,0 +1,49 @@
+#ifndef ROTEIRO_EVENTOS_HPP
+#define ROTEIRO_EVENTOS_HPP
+
+#include "Ambiente.hpp"
+#include <cstddef>
+#include <string>
+#include <vector>
+
+class Simulacao;
+
+// Eventos agendados para uma execução sem jogador (ensembles, varreduras).
+// Arquivo texto, um evento por linha:
+//
+//     # tempo(s)  zona       evento               duração(s)
+//     120         PERIFERIA  TEMPERATURA_EXTREMA  30
+//
+// Linhas vazias e começadas por '#' são ignoradas.
+class RoteiroEventos {
+public:
+    struct Entrada {
+        float tempo;
+        ZonaPlaneta zona;
+        TipoEvento evento;
+        float duracao;
+    };
+
+private:
+    std::vector<Entrada> entradas;   // em ordem de tempo
+    size_t proxima;
+
+public:
+    RoteiroEventos() : proxima(0) {}
+
+    // false (com a linha problemática em `erro`) se o arquivo for inválido
+    bool carregar(const std::string& caminho, std::string& erro);
+    void adicionar(const Entrada& e);
+
+    // Ativa na simulação os eventos com tempo <= getTempoSimulacao() ainda não aplicados
+    void aplicar(Simulacao& sim);
+    void reiniciar() { proxima = 0; }
+
+    const std::vector<Entrada>& getEntradas() const { return entradas; }
+    bool vazio() const { return entradas.empty(); }
+
+    static bool lerZona(const std::string& nome, ZonaPlaneta& zona);
+    static bool lerEvento(const std::string& nome, TipoEvento& evento);
+};
+
+#endif // ROTEIRO_EVENTOS_HPP
@@ -0,0 +1,228 @@
+#ifndef SIMULACAO_HPP
+#define SIMULACAO_HPP
+
+#include "Organismo.hpp"
+#include "Ambiente.hpp"
+#include "Populacao.hpp"
+#include "Missao.hpp"
+#include "PoolTrabalho.hpp"
+#include "RegistroLinhagem.hpp"
+#include "ParametrosSimulacao.hpp"
+#include "RegistroReplay.hpp"
+#include "Snapshot.hpp"
+#include "Telemetria.hpp"
+#include <cstdint>
+#include <memory>
+#include <string>
+
+// O que aconteceu durante uma chamada a Simulacao::passo, para que a
+// interface (ou um executor sem janela) possa reagir.
+struct ResultadoAtualizacao {
+    bool missaoCompletada = false;
+    bool missaoFalhada = false;
+    std::string nomeMissao;
+    int pontosMissao = 0;
+
+    bool faseAvancou = false;
+    bool sistemaColapsou = false;
+};
+
+// Núcleo da simulação: as três zonas (Ambiente + Populacao), as missões e a
+// progressão de fases. Não depende do raylib e avança em ticks de duração
+// fixa: o resultado não depende do FPS de quem a executa, e a taxa de tick
+// pode ser ajustada independentemente da tela.
+class Simulacao {
+public:
+    static constexpr float TAXA_TICK_PADRAO = 60.0f;
+
+    // Abaixo desta população total as zonas são atualizadas em sequência:
+    // acordar as threads custaria mais que o próprio tick. Medido: a biologia
+    // custa ~9 ns por organismo e roda a cada 2 ticks (30 Hz a 60 Hz), e um
+    // lote do PoolTrabalho ~5 us; dividir as zonas poupa 2/3 do trabalho, o
+    // que só paga o lote a partir de ~3 * 5 us / 9 ns organismos. Com o teto
+    // padrão (60 por zona) não é alcançado: ver populacaoMaximaZona.
+    static constexpr int LIMIAR_POPULACAO_PARALELA = 1500;
+
+    // Duração de um passoRapido(). Não passa do intervalo de envelhecimento
+    // nem do menor cooldown de reprodução, para que cada organismo tenha no
+    // máximo um evento de cada tipo por passo longo; cooldowns calibrados
+    // abaixo dele encurtam o passo (ver getDuracaoPassoRapido).
+    static constexpr float PASSO_RAPIDO = 1.0f;
+
+private:
+    std::unique_ptr<Ambiente> ambientes[NUM_ZONAS];
+    std::unique_ptr<Populacao> populacoes[NUM_ZONAS];
+    std::unique_ptr<GestorMissoes> gestorMissoes;
+
+    // Threads auxiliares para atualizar as zonas em paralelo. O pool só é
+    // criado quando a população passa do limiar pela primeira vez.
+    int threadsTrabalho;
+    std::unique_ptr<PoolTrabalho> poolTrabalho;
+
+    // Genealogia (opcional; nulo = desligada)
+    std::unique_ptr<RegistroLinhagem> linhagem;
+
+    // Gravação de replay (opcional; nulo = desligada)
+    std::unique_ptr<RegistroReplay> replay;
+
+    // Série temporal (opcional; nulo = desligada), uma amostra a cada
+    // periodoTelemetria ticks
+    std::unique_ptr<RegistroTelemetria> telemetria;
+    int periodoTelemetria;
+    uint64_t ultimoTickTelemetria;
+
+    int fase;
+
+    // Semente da partida; cada zona sorteia do fluxo (semente, zona)
+    uint64_t semente;
+
+    // Calibragem aplicada às zonas em inicializar()
+    ParametrosSimulacao parametros;
+
+    // Passo fixo (segundos de simulação por tick)
+    float passoFixo;
+    uint64_t tickAtual;
+
+    // O tempo sai da contagem de ticks, em double: somar passoFixo em float
+    // a cada tick derivava (300 s viravam 18002 ticks). A taxa pode mudar no
+    // meio da partida, então conta a partir da última troca.
+    double ticksPorSegundo;
+    double tempoBase;     // tempo no tick da última troca de taxa
+    uint64_t tickBase;
+
+    // Agenda multi-taxa: período de cada subsistema em ticks e o último
+    // tick em que rodou. Na mesma execução, o ambiente roda antes da
+    // biologia e as missões depois de todas as zonas, então cada um lê o
+    // estado que o outro publicou por último.
+    FrequenciasSubsistemas frequencias;
+    int periodoAmbiente;
+    int periodoBiologia;
+    int periodoMissoes;
+    uint64_t ultimoTickAmbiente[NUM_ZONAS];
+    uint64_t ultimoTickBiologia[NUM_ZONAS];
+    uint64_t ultimoTickMissoes;
+
+    // Fase 2
+    float vidaSupercomputador;
+    float vidaMaximaSupercomputador;
+
+    ResultadoAtualizacao atualizar(int ticks, bool permitirPassoLongo);
+    void avancarZona(int z, uint64_t primeiroTick, bool permitirPassoLongo);
+    void atualizarZona(int z, uint64_t tick, bool ambiente, bool biologia);
+    void atualizarMissoes(ResultadoAtualizacao& resultado);
+    void recalcularPeriodos();
+    void recolherNascimentos();
+    void registrarComando(TipoComando tipo, int zona = 0, int codigo = 0, float valor = 0);
+    void publicarTelemetria();
+    void verificarCondicoesAvanco(ResultadoAtualizacao& resultado);
+    void avancarFase();
+
+public:
+    Simulacao();
+    ~Simulacao();
+
+    void inicializar(uint64_t semente);
+
+    // Avança exatamente um tick de getPassoFixo() segundos
+    ResultadoAtualizacao passo();
+
+    // Avança getDuracaoPassoRapido() segundos (em ticks inteiros). Zonas
+    // quiescentes andam de uma vez só: com o ambiente constante, energia e
+    // órbita são lineares no tempo e um passo longo dá o mesmo resultado que
+    // os ticks somados; envelhecimento, reprodução e seleção natural usam as
+    // chances acumuladas do intervalo. As demais zonas andam tick a tick.
+    // Para observação longa; não reproduz a mesma partida que passo().
+    ResultadoAtualizacao passoRapido();
+    // PASSO_RAPIDO, ou o menor cooldown de reprodução se for mais curto
+    float getDuracaoPassoRapido() const;
+
+    // Valem a partir do próximo inicializar()
+    void setParametros(const ParametrosSimulacao& p) { parametros = p; }
+    const ParametrosSimulacao& getParametros() const { return parametros; }
+
+    void setTaxaTick(float ticksPorSegundo);
+    float getTaxaTick() const { return 1.0f / passoFixo; }
+    float getPassoFixo() const { return passoFixo; }
+    uint64_t getTickAtual() const { return tickAtual; }
+
+    void setFrequencias(const FrequenciasSubsistemas& f);
+    const FrequenciasSubsistemas& getFrequencias() const { return frequencias; }
+
+    // Fração (0..1) entre os dois últimos estados da biologia da zona, dada
+    // a fração do tick base já decorrida; a renderização interpola com ela
+    float getAlphaBiologia(ZonaPlaneta zona, float alphaTick) const;
+
+    // Threads auxiliares para as zonas (0 = tudo na thread chamadora). Só
+    // são criadas quando a população passa de LIMIAR_POPULACAO_PARALELA.
+    void setThreadsTrabalho(int numThreads);
+    int getThreadsTrabalho() const { return threadsTrabalho; }
+
+    // Genealogia de todos os nascimentos a partir de agora. Chame antes de
+    // inicializar() para incluir os organismos iniciais.
+    RegistroLinhagem& ativarLinhagem();
+    RegistroLinhagem* getLinhagem() { return linhagem.get(); }
+    const RegistroLinhagem* getLinhagem() const { return linhagem.get(); }
+
+    // Replay: a partir de agora grava a semente, a configuração e cada ação
+    // de fora da simulação (abaixo) com o tick. Chame depois de
+    // inicializar(); um novo inicializar() ou a destruição encerram o
+    // arquivo com o tick e o checksum finais.
+    bool gravarReplay(const std::string& caminho);
+    void encerrarReplay();
+    bool gravandoReplay() const { return replay && replay->gravando(); }
+    // Reexecuta um comando gravado (os de avanço e informativos são ignorados)
+    void aplicarComando(const ComandoReplay& c);
+    // Velocidade da tela, só para constar no replay
+    void anotarVelocidade(float multiplicador);
+
+    // Telemetria: a cada `periodoTicks` ticks (e uma vez ao ligar) publica
+    // uma AmostraTelemetria num anel sem trava; uma thread a grava no arquivo
+    // colunar. Chame depois de inicializar(); um novo inicializar() ou a
+    // destruição fecham o arquivo.
+    bool gravarTelemetria(const std::string& caminho, int periodoTicks = 1);
+    void encerrarTelemetria();
+    const RegistroTelemetria* getTelemetria() const { return telemetria.get(); }
+    void preencherAmostra(AmostraTelemetria& a) const;
+
+    // Resumo (FNV-1a) do estado simulado: zonas, organismos, geradores,
+    // missões e progresso. Igual em duas execuções = mesma partida.
+    uint64_t calcularChecksum() const;
+
+    // Acesso às zonas
+    Ambiente& getAmbiente(ZonaPlaneta zona) { return *ambientes[static_cast<int>(zona)]; }
+    const Ambiente& getAmbiente(ZonaPlaneta zona) const { return *ambientes[static_cast<int>(zona)]; }
+    Populacao& getPopulacao(ZonaPlaneta zona) { return *populacoes[static_cast<int>(zona)]; }
+    const Populacao& getPopulacao(ZonaPlaneta zona) const { return *populacoes[static_cast<int>(zona)]; }
+    GestorMissoes& getGestorMissoes() { return *gestorMissoes; }
+    const GestorMissoes& getGestorMissoes() const { return *gestorMissoes; }
+
+    // Getters
+    int getFase() const { return fase; }
+    uint64_t getSemente() const { return semente; }
+    double getTempoSimulacao() const { return tempoBase + (tickAtual - tickBase) / ticksPorSegundo; }
+    // Só para exibição; comparações e saídas usam getTempoSimulacao()
+    float getTempoTotal() const { return static_cast<float>(getTempoSimulacao()); }
+    float getVidaSupercomputador() const { return vidaSupercomputador; }
+    float getVidaMaximaSupercomputador() const { return vidaMaximaSupercomputador; }
+    float getConscienciaMedia() const;
+    int getPopulacaoTotal() const;
+    bool sistemaColapsado() const { return vidaSupercomputador <= 0; }
+
+    // Snapshot do mundo inteiro (zonas, organismos, temporizadores,
+    // geradores, missões, vida e agenda dos subsistemas). Carregar substitui
+    // o mundo só se o arquivo for válido e encerra o replay em gravação:
+    // a partida carregada não parte de uma semente.
+    bool salvarSnapshot(const std::string& caminho) const;
+    // As seções do snapshot, referenciando o estado atual (não copia)
+    void salvarEstado(GravadorSnapshot& snapshot) const;
+    bool carregarSnapshot(const std::string& caminho, std::string& erro);
+
+    // Ações do jogador
+    void ativarEvento(ZonaPlaneta zona, TipoEvento evento, float duracao = 30.0f);
+    void reduzirTempoEvento(ZonaPlaneta zona, float segundos);
+    void cancelarEventos();
+    void notificarAcaoManual(TipoMissao tipo);
+    void repararSistema(float quantidade);
+};
+
+#endif // SIMULACAO_HPP
@@ -5,10 +5,11 @@
 #include "Ambiente.hpp"
 #include "Populacao.hpp"
 #include "Missao.hpp"
+#include "Simulacao.hpp"
+#include "AutoSalvamento.hpp"
 #include <memory>
 #include <vector>
 #include <string>
-#include <unordered_map>
 #include <raylib.h>
 
 enum class EstadoJogo {
@@ -37,29 +38,40 @@ private:
     
     // Estado do jogo
     EstadoJogo estadoAtual;
-    int fase;
     bool jogoTerminado;
     bool pausado;
     
-    // Componentes principais
-    std::unique_ptr<Ambiente> ambienteNucleo;
-    std::unique_ptr<Ambiente> ambienteHabitavel;
-    std::unique_ptr<Ambiente> ambientePeriferia;
-    
-    std::unique_ptr<Populacao> populacaoNucleo;
-    std::unique_ptr<Populacao> populacaoHabitavel;
-    std::unique_ptr<Populacao> populacaoPeriferia;
-    
-    std::unique_ptr<GestorMissoes> gestorMissoes;
+    // Núcleo da simulação (zonas, populações, missões e fases)
+    std::unique_ptr<Simulacao> simulacao;
+    uint64_t semente;
+
+    // Replay de cada partida (vazio = não grava); ver observador_replay
+    std::string arquivoReplay;
+    // Telemetria de cada partida (vazio, o padrão, = não grava); ver
+    // observador_telemetria
+    std::string arquivoTelemetria;
+
+    // Salvamento automático periódico, gravado em segundo plano (F10 recupera)
+    std::unique_ptr<AutoSalvamento> autoSalvamento;
+    double ultimoAutoSalvamento = 0.0;
     
     // Variáveis de jogo
-    float tempoTotal;
     int geracao;
     float velocidadeSimulacao;
-    
-    // Fase 2
-    float vidaSupercomputador;
-    float vidaMaximaSupercomputador;
+
+    // Loop de passo fixo: tempo de jogo ainda não consumido pela simulação e
+    // fração do próximo tick usada para interpolar a renderização
+    float acumuladorTick = 0.0f;
+    float alphaInterpolacao = 0.0f;
+
+    // Modo turbo (acima de 4x): muitos ticks por quadro dentro de um
+    // orçamento de tempo. -1 = desligado, senão índice em NIVEIS_TURBO.
+    // No nível MAX a simulação usa passos longos (Simulacao::passoRapido).
+    int nivelTurbo = -1;
+    bool turboLimitado = false;          // o orçamento estourou e o atraso foi descartado
+    float velocidadeAlcancada = 0.0f;    // tempo simulado / tempo real (média recente)
+    double janelaTempoReal = 0.0;
+    double janelaTempoSimulado = 0.0;
     
     // Fase 3
     float degradacaoVisual;
@@ -67,6 +79,11 @@ private:
     // Decisão narrativa (obedecer ou resistir ao sistema)
     bool obedeceuSistema = false;
     
+    // Inspeção: organismo clicado no planeta (handle inválido = nenhum)
+    ZonaPlaneta zonaInspecionada = ZonaPlaneta::HABITAVEL;
+    HandleOrganismo organismoInspecionado;
+    std::vector<size_t> vizinhosCandidatos;
+
     // Menus
     ZonaPlaneta zonaSelecionada;
     TipoEvento eventoSelecionado;
@@ -77,20 +94,27 @@ private:
     
     // Visual NOVO!
     std::vector<Estrela> estrelas;
+    GeradorAleatorio geradorEstrelas;   // fluxo próprio: o visual não consome sorteios da simulação
     float animacaoDesligar;
     float tempoAnimacao;
 
     // Transição de abertura (ao sair da tela inicial)
     float animacaoAbertura = 0.0f; // 1.0 = fechado, 0.0 = aberto
 
-    // Catálogo: texturas dos organismos (carregadas uma vez)
-    std::unordered_map<std::string, Texture2D> texturasCatalogo;
+    // Catálogo: referências no GerenciadorTexturas (mantêm as 12 texturas
+    // carregadas durante toda a sessão, mesmo quando uma espécie se extingue)
     bool texturasCatalogoCarregadas = false;
+
+    // Overlay de desempenho (F3). O Perfilador mede sempre; o overlay só mostra.
+    bool mostrarPerfilador = false;
+    std::vector<float> historicoQuadros;
     
     // Métodos privados
-    void atualizarSimulacao(float deltaTime);
-    void verificarCondicoesAvanco();
-    void avancarFase();
+    void atualizarSimulacao(bool passoLongo = false);
+    void executarTicks(float tempoJogo, bool semLimite);
+    void medirVelocidade(float tempoQuadro, double tempoSimulado);
+    void selecionarOrganismo(Vector2 posicaoTela);
+    void mostrarNarrativaFase(int fase);
     
     // Renderização
     void renderizarTelaInicial();
@@ -104,21 +128,20 @@ private:
     void renderizarFinal();
     void renderizarEstrelas();  // NOVO!
     void renderizarInterfacePC();  // NOVO!
+    void renderizarInspecao();
+    void renderizarPerfilador();
 
     // Helpers
-    Ambiente* getAmbientePorZona(ZonaPlaneta zona);
-    Populacao* getPopulacaoPorZona(ZonaPlaneta zona);
     Color getCorComDegradacao(Color cor) const;
     void adicionarMensagemNarrativa(const std::string& mensagem);
 
     // Catálogo
     void carregarTexturasCatalogo();
     void descarregarTexturasCatalogo();
-    Texture2D* getTexturaCatalogo(const std::string& chave);
-    std::string resolverCaminhoAsset(const std::string& relativo) const;
+    const Texture2D* getTexturaCatalogo(TipoOrganismo tipo) const;
     
 public:
-    Simulador(int largura, int altura);
+    Simulador(int largura, int altura, uint64_t semente);
     ~Simulador();
     
     // Loop principal
@@ -137,12 +160,20 @@ public:
     void finalizarJogo();
     void reiniciar();
     
+    // Taxa de tick da simulação (independente do FPS)
+    void setTaxaTick(float ticksPorSegundo);
+
+    // Onde gravar o replay da partida ("" desliga)
+    void setArquivoReplay(const std::string& caminho) { arquivoReplay = caminho; }
+    // Onde gravar a telemetria da partida ("" desliga)
+    void setArquivoTelemetria(const std::string& caminho) { arquivoTelemetria = caminho; }
+
     // Eventos
     void ativarEvento(ZonaPlaneta zona, TipoEvento evento);
     
-    // Save/Load
-    void salvarJogo(const std::string& arquivo);
-    void carregarJogo(const std::string& arquivo);
+    // Save/Load (snapshot binário do mundo inteiro; ver Snapshot)
+    bool salvarJogo(const std::string& arquivo);
+    bool carregarJogo(const std::string& arquivo);
 };
 
 #endif // SIMULADOR_HPP
\ No newline at end of file
@@ -0,0 +1,127 @@
+#ifndef SNAPSHOT_HPP
+#define SNAPSHOT_HPP
+
+#include "ArquivoMapeado.hpp"
+#include <cstddef>
+#include <cstdint>
+#include <string>
+#include <type_traits>
+#include <vector>
+
+// Foto binária do mundo inteiro (F5/F9, checkpoints de experimentos longos).
+// Cada classe grava o próprio estado em seções com nome: valores soltos vão
+// como uma struct, e cada coluna do OrganismoPool vai inteira, do jeito que
+// está na memória. Gravar e ler são poucas operações grandes, sem conversão
+// campo a campo. O leitor mapeia o arquivo em memória (ArquivoMapeado):
+// como as colunas já estão no layout do OrganismoPool, carregar um mundo
+// grande é uma cópia por coluna direto do cache de páginas.
+//
+// Formato (ordem de bytes da máquina que gravou):
+//   cabeçalho (64 bytes): "OBSN" + uint32 versão + uint32 número de seções
+//   tabela: por seção, nome (32 bytes, terminado em zero) + uint64 posição
+//           + uint64 tamanho em bytes
+//   seções: cada uma começa num múltiplo de 64 bytes
+class GravadorSnapshot {
+public:
+    static constexpr size_t TAMANHO_NOME = 32;
+
+private:
+    struct Secao {
+        std::string nome;
+        const void* dados;
+        size_t tamanho;
+        size_t copia;   // índice em `copias`, ou SEM_COPIA
+    };
+    static constexpr size_t SEM_COPIA = static_cast<size_t>(-1);
+
+    std::vector<Secao> secoes;
+    std::vector<std::vector<char>> copias;
+
+public:
+    // Referencia `dados` sem copiar: precisa continuar válido até gravar()
+    void adicionar(const std::string& nome, const void* dados, size_t tamanho);
+    // Copia `dados` (para valores montados na hora)
+    void adicionarCopia(const std::string& nome, const void* dados, size_t tamanho);
+
+    template <typename T>
+    void adicionarColuna(const std::string& nome, const std::vector<T>& coluna) {
+        static_assert(std::is_trivially_copyable<T>::value, "coluna precisa ser copiável byte a byte");
+        adicionar(nome, coluna.data(), coluna.size() * sizeof(T));
+    }
+
+    template <typename T>
+    void adicionarValor(const std::string& nome, const T& valor) {
+        static_assert(std::is_trivially_copyable<T>::value, "valor precisa ser copiável byte a byte");
+        adicionarCopia(nome, &valor, sizeof(T));
+    }
+
+    bool gravar(const std::string& caminho) const;
+    void limpar();
+
+    // Seções adicionadas, na ordem
+    size_t getNumSecoes() const { return secoes.size(); }
+    const std::string& getNome(size_t i) const { return secoes[i].nome; }
+    const char* getDados(size_t i) const;
+    size_t getTamanho(size_t i) const { return secoes[i].tamanho; }
+};
+
+class LeitorSnapshot {
+private:
+    struct Secao {
+        std::string nome;
+        uint64_t posicao;
+        uint64_t tamanho;
+    };
+
+    ArquivoMapeado arquivo;
+    std::vector<Secao> secoes;
+
+public:
+    // false (com o motivo em `erro`) se o arquivo não for um snapshot válido
+    bool abrir(const std::string& caminho, std::string& erro);
+
+    // Início e tamanho da seção, ou nulo se ela não existir
+    const char* getSecao(const std::string& nome, size_t& tamanho) const;
+
+    size_t getNumSecoes() const { return secoes.size(); }
+    const std::string& getNomeSecao(size_t i) const { return secoes[i].nome; }
+
+    // A coluna no próprio mapeamento, sem cópia (vale enquanto o leitor
+    // estiver aberto), ou nulo se não existir ou não couber em T
+    template <typename T>
+    const T* verColuna(const std::string& nome, size_t& quantidade) const {
+        static_assert(std::is_trivially_copyable<T>::value, "coluna precisa ser copiável byte a byte");
+        size_t tamanho = 0;
+        const char* dados = getSecao(nome, tamanho);
+        if (!dados || tamanho % sizeof(T) != 0 || reinterpret_cast<uintptr_t>(dados) % alignof(T) != 0) {
+            return nullptr;
+        }
+        quantidade = tamanho / sizeof(T);
+        return reinterpret_cast<const T*>(dados);
+    }
+
+    // Copia a coluna inteira de uma vez (as seções são alinhadas a 64 bytes)
+    template <typename T>
+    bool lerColuna(const std::string& nome, std::vector<T>& coluna) const {
+        size_t quantidade = 0;
+        const T* dados = verColuna<T>(nome, quantidade);
+        if (!dados) return false;
+        coluna.assign(dados, dados + quantidade);
+        return true;
+    }
+
+    template <typename T>
+    bool lerValor(const std::string& nome, T& valor) const {
+        static_assert(std::is_trivially_copyable<T>::value, "valor precisa ser copiável byte a byte");
+        size_t tamanho = 0;
+        const char* dados = getSecao(nome, tamanho);
+        if (!dados || tamanho != sizeof(T)) return false;
+        copiar(&valor, dados, tamanho);
+        return true;
+    }
+
+private:
+    static void copiar(void* destino, const char* origem, size_t tamanho);
+};
+
+#endif // SNAPSHOT_HPP
@@ -0,0 +1,118 @@
+#ifndef TELEMETRIA_HPP
+#define TELEMETRIA_HPP
+
+#include "Organismo.hpp"
+#include <atomic>
+#include <cstddef>
+#include <cstdint>
+#include <fstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+// Uma linha da série temporal de uma execução. Só contagens e médias que a
+// Populacao já mantém (EstatisticasPopulacao), então montar uma amostra não
+// percorre organismos.
+struct AmostraTelemetria {
+    uint64_t tick;
+    float tempo;
+    int32_t fase;
+    float consciencia;                       // média das zonas
+    float vidaSupercomputador;
+    int32_t missoesCompletadas;
+    int32_t pontuacao;
+
+    int32_t populacao[NUM_ZONAS];
+    float energiaMedia[NUM_ZONAS];
+    float idadeMedia[NUM_ZONAS];
+    float temperatura[NUM_ZONAS];
+    float recursos[NUM_ZONAS];
+    int32_t evento[NUM_ZONAS];               // TipoEvento ativo (0 = nenhum)
+
+    int32_t populacaoTipo[NUM_TIPOS_ORGANISMO];   // somada nas três zonas
+};
+
+// Fila de uma produtora e uma consumidora, sem trava: a simulação publica e
+// a thread de escoamento retira. Capacidade em potência de dois; cheia, a
+// amostra é descartada (e contada) em vez de a simulação esperar.
+class AnelTelemetria {
+private:
+    std::vector<AmostraTelemetria> amostras;
+    size_t mascara;
+
+    // Em linhas de cache separadas: cada índice só é escrito por um lado
+    alignas(64) std::atomic<size_t> cabeca;   // próxima a retirar (consumidora)
+    alignas(64) std::atomic<size_t> cauda;    // próxima a publicar (produtora)
+    alignas(64) std::atomic<uint64_t> descartadas;
+
+public:
+    explicit AnelTelemetria(size_t capacidade);
+
+    bool publicar(const AmostraTelemetria& a);
+    bool retirar(AmostraTelemetria& a);
+
+    size_t getCapacidade() const { return amostras.size(); }
+    uint64_t getDescartadas() const { return descartadas.load(std::memory_order_relaxed); }
+};
+
+// Grava as amostras publicadas num arquivo colunar, em segundo plano.
+//
+// Formato (ordem de bytes da máquina que gravou):
+//   cabeçalho: "OBTM" + uint32 versão + uint32 numColunas, e por coluna
+//              nome[32] + uint8 tipo (0 = uint64, 1 = int32, 2 = float32)
+//   blocos:    uint32 n, seguido das colunas inteiras (n valores cada)
+class RegistroTelemetria {
+public:
+    static constexpr size_t TAMANHO_NOME = 32;
+    static constexpr size_t CAPACIDADE_PADRAO = 1 << 14;
+    static constexpr size_t TAMANHO_BLOCO = 4096;
+
+    enum class TipoColuna : uint8_t { U64, I32, F32 };
+    struct Coluna {
+        std::string nome;
+        TipoColuna tipo;
+        size_t deslocamento;   // em AmostraTelemetria
+    };
+
+    // As colunas do arquivo, na ordem: tick, tempo, globais, <ZONA>.*, <Espécie>.populacao
+    static const std::vector<Coluna>& getColunas();
+
+private:
+    AnelTelemetria anel;
+    std::ofstream arquivo;
+    std::thread thread;
+    std::atomic<bool> encerrando;
+    std::vector<AmostraTelemetria> bloco;   // só a thread de escoamento
+    uint64_t totalGravado;
+    bool falhou;
+
+    void lacoEscoamento();
+    void escoar();
+    void gravarBloco();
+
+public:
+    explicit RegistroTelemetria(size_t capacidade = CAPACIDADE_PADRAO);
+    ~RegistroTelemetria();   // fecha o arquivo com o que restar no anel
+
+    RegistroTelemetria(const RegistroTelemetria&) = delete;
+    RegistroTelemetria& operator=(const RegistroTelemetria&) = delete;
+
+    bool abrir(const std::string& caminho);
+    void fechar();
+    bool aberto() const { return arquivo.is_open(); }
+
+    // Da thread da simulação; não bloqueia
+    bool publicar(const AmostraTelemetria& a) { return anel.publicar(a); }
+
+    uint64_t getDescartadas() const { return anel.getDescartadas(); }
+    // Válidos depois de fechar()
+    uint64_t getTotalGravado() const { return totalGravado; }
+    bool getFalhou() const { return falhou; }
+
+    // Lê um arquivo gravado por esta versão
+    static bool carregar(const std::string& caminho, std::vector<AmostraTelemetria>& amostras, std::string& erro);
+    // Uma linha por amostra, com os nomes de getColunas() no cabeçalho
+    static bool exportarCSV(const std::vector<AmostraTelemetria>& amostras, const std::string& caminho);
+};
+
+#endif // TELEMETRIA_HPP
@@ -1,32 +1,27 @@
 #include "../include/Ambiente.hpp"
+#include "../include/Perfilador.hpp"
+#include <algorithm>
 #include <cmath>
 
-Ambiente::Ambiente(ZonaPlaneta z) 
-    : zona(z), eventoAtual(TipoEvento::NENHUM), duracaoEvento(0), 
-      tempoRestanteEvento(0), consciencia(0), conscienciaMaxima(150), 
-      populacaoAtual(0), mortesRecentes(0) {
-    
-    // Configurar condições base por zona
+CondicoesZona Ambiente::getCondicoesPadrao(ZonaPlaneta zona) {
     switch(zona) {
         case ZonaPlaneta::NUCLEO:
-            temperaturaBase = 0.9f;
-            nivelRecursosBase = 0.8f;
-            taxaConsumo = 1.5f;
-            break;
-            
+            return CondicoesZona{0.9f, 0.8f, 1.5f};
         case ZonaPlaneta::HABITAVEL:
-            temperaturaBase = 0.5f;
-            nivelRecursosBase = 1.0f;
-            taxaConsumo = 1.0f;
-            break;
-            
+            return CondicoesZona{0.5f, 1.0f, 1.0f};
         case ZonaPlaneta::PERIFERIA:
-            temperaturaBase = 0.2f;
-            nivelRecursosBase = 0.4f;
-            taxaConsumo = 0.7f;
-            break;
+        default:
+            return CondicoesZona{0.2f, 0.4f, 0.7f};
     }
-    
+}
+
+Ambiente::Ambiente(ZonaPlaneta z) : Ambiente(z, getCondicoesPadrao(z)) {}
+
+Ambiente::Ambiente(ZonaPlaneta z, const CondicoesZona& condicoes)
+    : zona(z), temperaturaBase(condicoes.temperaturaBase), nivelRecursosBase(condicoes.nivelRecursosBase),
+      taxaConsumo(condicoes.taxaConsumo), relogio(0), eventoAtual(TipoEvento::NENHUM), duracaoEvento(0),
+      fimEvento(0), consciencia(0), conscienciaMaxima(150),
+      populacaoAtual(0), mortesRecentes(0) {
     temperatura = temperaturaBase;
     nivelRecursos = nivelRecursosBase;
 }
@@ -34,24 +29,25 @@ Ambiente::Ambiente(ZonaPlaneta z)
 Ambiente::~Ambiente() {}
 
 void Ambiente::atualizar(float deltaTime) {
+    CronometroEscopo cronometro(SecaoPerfil::AMBIENTE);
+    relogio += deltaTime;
+    
     // Aumentar consciência com o tempo
     consciencia += 1.0f * deltaTime;
     
     // Processar evento atual
     if (eventoAtual != TipoEvento::NENHUM) {
-        tempoRestanteEvento -= deltaTime;
-        
         // Aumentar consciência durante eventos
         consciencia += 2.0f * deltaTime;
         
         aplicarEfeitosEvento();
         
-        if (tempoRestanteEvento <= 0) {
+        if (relogio >= fimEvento) {
             cancelarEvento();
         }
     } else {
         // Restaurar condições base gradualmente
-        restaurarCondicoesBase();
+        restaurarCondicoesBase(deltaTime);
     }
     
     // Limitar valores
@@ -64,20 +60,25 @@ void Ambiente::atualizar(float deltaTime) {
 void Ambiente::ativarEvento(TipoEvento evento, float duracao) {
     eventoAtual = evento;
     duracaoEvento = duracao;
-    tempoRestanteEvento = duracao;
+    fimEvento = relogio + duracao;
 }
 
 void Ambiente::cancelarEvento() {
     eventoAtual = TipoEvento::NENHUM;
-    tempoRestanteEvento = 0;
+    fimEvento = relogio;
+}
+
+float Ambiente::getTempoRestanteEvento() const {
+    if (eventoAtual == TipoEvento::NENHUM) return 0.0f;
+    return static_cast<float>(fimEvento - relogio);
 }
 
 void Ambiente::reduzirTempoEvento(float segundos) {
     if (eventoAtual == TipoEvento::NENHUM) return;
     if (segundos <= 0) return;
 
-    tempoRestanteEvento -= segundos;
-    if (tempoRestanteEvento <= 0.0f) {
+    fimEvento -= segundos;
+    if (fimEvento <= relogio) {
         cancelarEvento();
     }
 }
@@ -139,18 +140,19 @@ void Ambiente::aplicarEfeitosEvento() {
     }
 }
 
-void Ambiente::restaurarCondicoesBase() {
-    float velocidade = 0.01f;
+void Ambiente::restaurarCondicoesBase(float deltaTime) {
+    // Por segundo (era 0.01 por quadro a 60 FPS)
+    float passo = 0.6f * deltaTime;
     
     if (temperatura > temperaturaBase)
-        temperatura -= velocidade;
+        temperatura = std::max(temperaturaBase, temperatura - passo);
     else if (temperatura < temperaturaBase)
-        temperatura += velocidade;
+        temperatura = std::min(temperaturaBase, temperatura + passo);
         
     if (nivelRecursos > nivelRecursosBase)
-        nivelRecursos -= velocidade;
+        nivelRecursos = std::max(nivelRecursosBase, nivelRecursos - passo);
     else if (nivelRecursos < nivelRecursosBase)
-        nivelRecursos += velocidade;
+        nivelRecursos = std::min(nivelRecursosBase, nivelRecursos + passo);
 }
 
 std::string Ambiente::getNomeZona() const {
@@ -174,11 +176,58 @@ std::string Ambiente::getDescricaoEvento() const {
     }
 }
 
-Color Ambiente::getCorZona() const {
-    switch(zona) {
-        case ZonaPlaneta::NUCLEO: return RED;
-        case ZonaPlaneta::HABITAVEL: return GREEN;
-        case ZonaPlaneta::PERIFERIA: return BLUE;
-        default: return WHITE;
-    }
-}
\ No newline at end of file
+// Campos de um Ambiente no snapshot
+struct EstadoAmbiente {
+    double relogio;
+    double fimEvento;
+    int32_t zona;
+    int32_t eventoAtual;
+    float temperatura;
+    float temperaturaBase;
+    float nivelRecursos;
+    float nivelRecursosBase;
+    float taxaConsumo;
+    float duracaoEvento;
+    float consciencia;
+    float conscienciaMaxima;
+    int32_t populacaoAtual;
+    int32_t mortesRecentes;
+};
+
+void Ambiente::salvarEstado(GravadorSnapshot& s, const std::string& p) const {
+    EstadoAmbiente e{};
+    e.relogio = relogio;
+    e.fimEvento = fimEvento;
+    e.zona = static_cast<int32_t>(zona);
+    e.eventoAtual = static_cast<int32_t>(eventoAtual);
+    e.temperatura = temperatura;
+    e.temperaturaBase = temperaturaBase;
+    e.nivelRecursos = nivelRecursos;
+    e.nivelRecursosBase = nivelRecursosBase;
+    e.taxaConsumo = taxaConsumo;
+    e.duracaoEvento = duracaoEvento;
+    e.consciencia = consciencia;
+    e.conscienciaMaxima = conscienciaMaxima;
+    e.populacaoAtual = populacaoAtual;
+    e.mortesRecentes = mortesRecentes;
+    s.adicionarValor(p + "ambiente", e);
+}
+
+bool Ambiente::carregarEstado(const LeitorSnapshot& s, const std::string& p) {
+    EstadoAmbiente e;
+    if (!s.lerValor(p + "ambiente", e) || e.zona != static_cast<int32_t>(zona)) return false;
+    relogio = e.relogio;
+    fimEvento = e.fimEvento;
+    eventoAtual = static_cast<TipoEvento>(e.eventoAtual);
+    temperatura = e.temperatura;
+    temperaturaBase = e.temperaturaBase;
+    nivelRecursos = e.nivelRecursos;
+    nivelRecursosBase = e.nivelRecursosBase;
+    taxaConsumo = e.taxaConsumo;
+    duracaoEvento = e.duracaoEvento;
+    consciencia = e.consciencia;
+    conscienciaMaxima = e.conscienciaMaxima;
+    populacaoAtual = e.populacaoAtual;
+    mortesRecentes = e.mortesRecentes;
+    return true;
+}
@@ -0,0 +1,92 @@
+#include "../include/ArquivoMapeado.hpp"
+
+#ifdef _WIN32
+#define WIN32_LEAN_AND_MEAN
+#define NOMINMAX
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+#ifdef _WIN32
+
+ArquivoMapeado::ArquivoMapeado()
+    : dados(nullptr), tamanho(0), arquivo(INVALID_HANDLE_VALUE), mapeamento(nullptr) {}
+
+bool ArquivoMapeado::abrir(const std::string& caminho, bool sequencial) {
+    fechar();
+    DWORD dica = sequencial ? FILE_FLAG_SEQUENTIAL_SCAN : FILE_FLAG_RANDOM_ACCESS;
+    arquivo = CreateFileA(caminho.c_str(), GENERIC_READ, FILE_SHARE_READ, nullptr, OPEN_EXISTING,
+                          FILE_ATTRIBUTE_NORMAL | dica, nullptr);
+    if (arquivo == INVALID_HANDLE_VALUE) return false;
+
+    LARGE_INTEGER tamanhoArquivo;
+    if (!GetFileSizeEx(arquivo, &tamanhoArquivo) || tamanhoArquivo.QuadPart == 0) {
+        fechar();
+        return false;
+    }
+    mapeamento = CreateFileMappingA(arquivo, nullptr, PAGE_READONLY, 0, 0, nullptr);
+    if (!mapeamento) {
+        fechar();
+        return false;
+    }
+    dados = static_cast<const char*>(MapViewOfFile(mapeamento, FILE_MAP_READ, 0, 0, 0));
+    if (!dados) {
+        fechar();
+        return false;
+    }
+    tamanho = static_cast<size_t>(tamanhoArquivo.QuadPart);
+    return true;
+}
+
+void ArquivoMapeado::fechar() {
+    if (dados) UnmapViewOfFile(dados);
+    if (mapeamento) CloseHandle(mapeamento);
+    if (arquivo != INVALID_HANDLE_VALUE) CloseHandle(arquivo);
+    dados = nullptr;
+    tamanho = 0;
+    mapeamento = nullptr;
+    arquivo = INVALID_HANDLE_VALUE;
+}
+
+#else
+
+ArquivoMapeado::ArquivoMapeado() : dados(nullptr), tamanho(0), descritor(-1) {}
+
+bool ArquivoMapeado::abrir(const std::string& caminho, bool sequencial) {
+    fechar();
+    descritor = ::open(caminho.c_str(), O_RDONLY);
+    if (descritor < 0) return false;
+
+    struct stat info;
+    if (fstat(descritor, &info) != 0 || info.st_size <= 0) {
+        fechar();
+        return false;
+    }
+    void* p = mmap(nullptr, static_cast<size_t>(info.st_size), PROT_READ, MAP_PRIVATE, descritor, 0);
+    if (p == MAP_FAILED) {
+        fechar();
+        return false;
+    }
+    madvise(p, static_cast<size_t>(info.st_size), sequencial ? MADV_SEQUENTIAL : MADV_RANDOM);
+    dados = static_cast<const char*>(p);
+    tamanho = static_cast<size_t>(info.st_size);
+    return true;
+}
+
+void ArquivoMapeado::fechar() {
+    if (dados) munmap(const_cast<char*>(dados), tamanho);
+    if (descritor >= 0) ::close(descritor);
+    dados = nullptr;
+    tamanho = 0;
+    descritor = -1;
+}
+
+#endif
+
+ArquivoMapeado::~ArquivoMapeado() {
+    fechar();
+}
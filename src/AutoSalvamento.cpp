@@ -0,0 +1,379 @@
+#include "../include/AutoSalvamento.hpp"
+#include "../include/Simulacao.hpp"
+#include "../include/Snapshot.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <fstream>
+#include <iterator>
+
+static const char ASSINATURA[4] = {'O', 'B', 'D', 'L'};
+static const char INICIO_REGISTRO[4] = {'O', 'B', 'D', 'R'};
+static const char FIM_REGISTRO[4] = {'F', 'I', 'M', 'R'};
+static constexpr uint32_t VERSAO_ARQUIVO = 1;
+static constexpr size_t TAMANHO_CABECALHO = 4 + sizeof(uint32_t) + sizeof(uint64_t);
+static const char* SECAO_GERACAO = "autosave.geracao";
+
+template <typename T>
+static void escrever(std::ofstream& arquivo, const T& valor) {
+    arquivo.write(reinterpret_cast<const char*>(&valor), sizeof(T));
+}
+
+// Leitura sequencial do delta com checagem de limites
+struct CursorDelta {
+    const char* dados;
+    size_t tamanho;
+    size_t posicao;
+
+    bool ler(void* destino, size_t n) {
+        if (tamanho - posicao < n) return false;
+        std::memcpy(destino, dados + posicao, n);
+        posicao += n;
+        return true;
+    }
+    const char* pular(size_t n) {
+        if (tamanho - posicao < n) return nullptr;
+        const char* p = dados + posicao;
+        posicao += n;
+        return p;
+    }
+};
+
+static bool substituir(const std::string& temporario, const std::string& destino) {
+#ifdef _WIN32
+    std::remove(destino.c_str());   // rename não sobrescreve no Windows
+#endif
+    return std::rename(temporario.c_str(), destino.c_str()) == 0;
+}
+
+static bool gravarCabecalhoDelta(const std::string& caminho, uint64_t geracao) {
+    std::ofstream arquivo(caminho, std::ios::binary | std::ios::trunc);
+    if (!arquivo.is_open()) return false;
+    arquivo.write(ASSINATURA, sizeof(ASSINATURA));
+    escrever(arquivo, VERSAO_ARQUIVO);
+    escrever(arquivo, geracao);
+    arquivo.close();
+    return static_cast<bool>(arquivo);
+}
+
+AutoSalvamento::AutoSalvamento(const std::string& caminho)
+    : caminhoBase(caminho), caminhoDelta(caminho + ".delta"),
+      temGravada(false), numDeltas(0), bytesBase(0), bytesDelta(0),
+      pendente(false), encerrando(false),
+      totalCapturas(0), capturasDescartadas(0), ultimaGravacaoBytes(0),
+      ultimaFoiCompleta(false), falhou(false) {
+    // Geração inicial diferente a cada sessão: um delta antigo que sobrou
+    // no disco nunca casa com uma base nova
+    geracao = static_cast<uint64_t>(std::chrono::system_clock::now().time_since_epoch().count());
+    thread = std::thread(&AutoSalvamento::lacoFundo, this);
+}
+
+AutoSalvamento::~AutoSalvamento() {
+    {
+        std::lock_guard<std::mutex> trava(mutex);
+        encerrando = true;
+    }
+    cv.notify_all();
+    thread.join();
+}
+
+bool AutoSalvamento::capturar(const Simulacao& sim) {
+    {
+        std::lock_guard<std::mutex> trava(mutex);
+        if (pendente) {
+            capturasDescartadas++;
+            return false;
+        }
+    }
+
+    // Sem a trava: enquanto !pendente a captura é só desta thread. Os buffers
+    // mantêm a capacidade entre capturas, então em regime é só memcpy.
+    GravadorSnapshot snapshot;
+    sim.salvarEstado(snapshot);
+    captura.resize(snapshot.getNumSecoes());
+    for (size_t i = 0; i < snapshot.getNumSecoes(); i++) {
+        const char* dados = snapshot.getDados(i);
+        captura[i].nome = snapshot.getNome(i);
+        captura[i].dados.assign(dados, dados + snapshot.getTamanho(i));
+    }
+
+    {
+        std::lock_guard<std::mutex> trava(mutex);
+        pendente = true;
+        totalCapturas++;
+    }
+    cv.notify_all();
+    return true;
+}
+
+void AutoSalvamento::aguardar() {
+    std::unique_lock<std::mutex> trava(mutex);
+    cv.wait(trava, [&] { return !pendente; });
+}
+
+void AutoSalvamento::lacoFundo() {
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> trava(mutex);
+            cv.wait(trava, [&] { return encerrando || pendente; });
+            // Uma captura já feita é gravada mesmo no encerramento
+            if (!pendente) return;
+        }
+
+        bool completa = !temGravada || numDeltas >= MAX_DELTAS || bytesDelta > bytesBase / 2;
+        uint64_t antes = bytesDelta;
+        bool ok = completa ? gravarBase(captura) : gravarDelta(captura);
+        if (!ok && !completa) {
+            // O delta pode ter sumido ou estar corrompido: recomeça pela base
+            completa = true;
+            ok = gravarBase(captura);
+        }
+        if (ok) {
+            captura.swap(gravada);
+            temGravada = true;
+        } else {
+            temGravada = false;
+        }
+
+        {
+            std::lock_guard<std::mutex> trava(mutex);
+            ultimaGravacaoBytes = completa ? bytesBase : bytesDelta - antes;
+            ultimaFoiCompleta = completa;
+            falhou = !ok;
+            pendente = false;
+        }
+        cv.notify_all();
+    }
+}
+
+bool AutoSalvamento::gravarImagem(const Imagem& imagem, uint64_t geracao, const std::string& caminho) {
+    GravadorSnapshot snapshot;
+    for (const Secao& s : imagem) {
+        if (s.nome != SECAO_GERACAO) snapshot.adicionar(s.nome, s.dados.data(), s.dados.size());
+    }
+    snapshot.adicionarValor(SECAO_GERACAO, geracao);
+    std::string temporario = caminho + ".tmp";
+    return snapshot.gravar(temporario) && substituir(temporario, caminho);
+}
+
+bool AutoSalvamento::gravarBase(const Imagem& imagem) {
+    // Base antes do delta: se cair entre os dois, o delta antigo fica com a
+    // geração anterior e é ignorado
+    geracao++;
+    if (!gravarImagem(imagem, geracao, caminhoBase) || !gravarCabecalhoDelta(caminhoDelta, geracao)) {
+        return false;
+    }
+    bytesBase = 0;
+    for (const Secao& s : imagem) bytesBase += s.dados.size();
+    bytesDelta = 0;
+    numDeltas = 0;
+    return true;
+}
+
+bool AutoSalvamento::gravarDelta(const Imagem& imagem) {
+    struct Alteracao {
+        const Secao* secao;
+        std::vector<uint32_t> paginas;
+    };
+    std::vector<Alteracao> alteracoes;
+
+    for (size_t i = 0; i < imagem.size(); i++) {
+        const Secao& s = imagem[i];
+        // A lista de seções quase nunca muda: tenta a mesma posição primeiro
+        const Secao* anterior = nullptr;
+        if (i < gravada.size() && gravada[i].nome == s.nome) {
+            anterior = &gravada[i];
+        } else {
+            for (const Secao& g : gravada) {
+                if (g.nome == s.nome) { anterior = &g; break; }
+            }
+        }
+
+        Alteracao a{&s, {}};
+        const size_t tamanho = s.dados.size();
+        for (size_t inicio = 0; inicio < tamanho; inicio += TAMANHO_PAGINA) {
+            size_t n = std::min(TAMANHO_PAGINA, tamanho - inicio);
+            if (!anterior || inicio + n > anterior->dados.size() ||
+                std::memcmp(s.dados.data() + inicio, anterior->dados.data() + inicio, n) != 0) {
+                a.paginas.push_back(static_cast<uint32_t>(inicio / TAMANHO_PAGINA));
+            }
+        }
+        if (!a.paginas.empty() || !anterior || anterior->dados.size() != tamanho) {
+            alteracoes.push_back(std::move(a));
+        }
+    }
+    if (alteracoes.empty()) return true;
+
+    std::ofstream arquivo(caminhoDelta, std::ios::binary | std::ios::app);
+    if (!arquivo.is_open()) return false;
+    // Em modo append tellp pode não refletir o tamanho; basta existir o cabeçalho
+    arquivo.seekp(0, std::ios::end);
+    if (static_cast<size_t>(arquivo.tellp()) < TAMANHO_CABECALHO) return false;
+
+    uint64_t escrito = 0;
+    arquivo.write(INICIO_REGISTRO, sizeof(INICIO_REGISTRO));
+    escrever(arquivo, static_cast<uint32_t>(alteracoes.size()));
+    for (const Alteracao& a : alteracoes) {
+        char nome[GravadorSnapshot::TAMANHO_NOME] = {};
+        std::memcpy(nome, a.secao->nome.data(), std::min(a.secao->nome.size(), sizeof(nome) - 1));
+        arquivo.write(nome, sizeof(nome));
+        escrever(arquivo, static_cast<uint64_t>(a.secao->dados.size()));
+        escrever(arquivo, static_cast<uint32_t>(a.paginas.size()));
+        for (uint32_t p : a.paginas) {
+            size_t inicio = static_cast<size_t>(p) * TAMANHO_PAGINA;
+            size_t n = std::min(TAMANHO_PAGINA, a.secao->dados.size() - inicio);
+            escrever(arquivo, p);
+            arquivo.write(a.secao->dados.data() + inicio, static_cast<std::streamsize>(n));
+            escrito += n;
+        }
+    }
+    arquivo.write(FIM_REGISTRO, sizeof(FIM_REGISTRO));
+    arquivo.close();
+    if (!arquivo) return false;
+
+    bytesDelta += escrito;
+    numDeltas++;
+    return true;
+}
+
+bool AutoSalvamento::consolidar(const std::string& caminho, std::string& erro) {
+    const std::string caminhoDelta = caminho + ".delta";
+    std::ifstream entrada(caminhoDelta, std::ios::binary);
+    if (!entrada.is_open()) return true;   // só a base
+    std::vector<char> delta((std::istreambuf_iterator<char>(entrada)), std::istreambuf_iterator<char>());
+    entrada.close();
+
+    Imagem imagem;
+    uint64_t geracaoBase = 0;
+    {
+        // O mapeamento é fechado antes de a base ser substituída
+        LeitorSnapshot leitor;
+        if (!leitor.abrir(caminho, erro)) return false;
+        if (!leitor.lerValor(SECAO_GERACAO, geracaoBase)) {
+            erro = caminho + " nao e um salvamento automatico";
+            return false;
+        }
+        imagem.resize(leitor.getNumSecoes());
+        for (size_t i = 0; i < leitor.getNumSecoes(); i++) {
+            size_t tamanho = 0;
+            const char* dados = leitor.getSecao(leitor.getNomeSecao(i), tamanho);
+            imagem[i].nome = leitor.getNomeSecao(i);
+            imagem[i].dados.assign(dados, dados + tamanho);
+        }
+    }
+
+    CursorDelta cursor{delta.data(), delta.size(), 0};
+    char assinatura[4];
+    uint32_t versao = 0;
+    uint64_t geracaoDelta = 0;
+    if (!cursor.ler(assinatura, sizeof(assinatura)) || std::memcmp(assinatura, ASSINATURA, sizeof(ASSINATURA)) != 0 ||
+        !cursor.ler(&versao, sizeof(versao)) || versao != VERSAO_ARQUIVO ||
+        !cursor.ler(&geracaoDelta, sizeof(geracaoDelta)) || geracaoDelta != geracaoBase) {
+        // Delta de outra base (queda durante a compactação): a base já basta
+        std::remove(caminhoDelta.c_str());
+        return true;
+    }
+
+    struct Pagina {
+        uint32_t indice;
+        const char* dados;
+        size_t tamanho;
+    };
+    struct Alteracao {
+        std::string nome;
+        uint64_t tamanho;
+        std::vector<Pagina> paginas;
+    };
+
+    int aplicados = 0;
+    for (;;) {
+        // O registro inteiro é validado antes de ser aplicado
+        std::vector<Alteracao> alteracoes;
+        uint32_t numSecoes = 0;
+        bool completo = cursor.ler(assinatura, sizeof(assinatura)) &&
+                        std::memcmp(assinatura, INICIO_REGISTRO, sizeof(INICIO_REGISTRO)) == 0 &&
+                        cursor.ler(&numSecoes, sizeof(numSecoes));
+        for (uint32_t s = 0; completo && s < numSecoes; s++) {
+            char nome[GravadorSnapshot::TAMANHO_NOME];
+            Alteracao a;
+            uint32_t numPaginas = 0;
+            completo = cursor.ler(nome, sizeof(nome)) && cursor.ler(&a.tamanho, sizeof(a.tamanho)) &&
+                       cursor.ler(&numPaginas, sizeof(numPaginas));
+            nome[sizeof(nome) - 1] = '\0';
+            a.nome = nome;
+            for (uint32_t p = 0; completo && p < numPaginas; p++) {
+                Pagina pagina{0, nullptr, 0};
+                completo = cursor.ler(&pagina.indice, sizeof(pagina.indice));
+                uint64_t inicio = static_cast<uint64_t>(pagina.indice) * TAMANHO_PAGINA;
+                completo = completo && inicio < a.tamanho;
+                if (!completo) break;
+                pagina.tamanho = static_cast<size_t>(std::min<uint64_t>(TAMANHO_PAGINA, a.tamanho - inicio));
+                pagina.dados = cursor.pular(pagina.tamanho);
+                completo = pagina.dados != nullptr;
+                a.paginas.push_back(pagina);
+            }
+            alteracoes.push_back(std::move(a));
+        }
+        completo = completo && cursor.ler(assinatura, sizeof(assinatura)) &&
+                   std::memcmp(assinatura, FIM_REGISTRO, sizeof(FIM_REGISTRO)) == 0;
+        if (!completo) break;   // fim do arquivo ou registro cortado
+
+        for (const Alteracao& a : alteracoes) {
+            Secao* secao = nullptr;
+            for (Secao& s : imagem) {
+                if (s.nome == a.nome) { secao = &s; break; }
+            }
+            if (!secao) {
+                imagem.push_back(Secao{a.nome, {}});
+                secao = &imagem.back();
+            }
+            secao->dados.resize(static_cast<size_t>(a.tamanho));
+            for (const Pagina& p : a.paginas) {
+                std::memcpy(secao->dados.data() + static_cast<size_t>(p.indice) * TAMANHO_PAGINA, p.dados, p.tamanho);
+            }
+        }
+        aplicados++;
+    }
+
+    if (aplicados > 0 && !gravarImagem(imagem, geracaoBase + 1, caminho)) {
+        erro = "nao foi possivel gravar " + caminho;
+        return false;
+    }
+    std::remove(caminhoDelta.c_str());
+    return true;
+}
+
+bool AutoSalvamento::recuperar(std::string& erro) {
+    aguardar();
+    bool ok = consolidar(caminhoBase, erro);
+    // A base foi regravada por fora: a próxima captura começa outra
+    std::lock_guard<std::mutex> trava(mutex);
+    temGravada = false;
+    return ok;
+}
+
+uint64_t AutoSalvamento::getTotalCapturas() {
+    std::lock_guard<std::mutex> trava(mutex);
+    return totalCapturas;
+}
+
+uint64_t AutoSalvamento::getCapturasDescartadas() {
+    std::lock_guard<std::mutex> trava(mutex);
+    return capturasDescartadas;
+}
+
+uint64_t AutoSalvamento::getUltimaGravacaoBytes() {
+    std::lock_guard<std::mutex> trava(mutex);
+    return ultimaGravacaoBytes;
+}
+
+bool AutoSalvamento::getUltimaFoiCompleta() {
+    std::lock_guard<std::mutex> trava(mutex);
+    return ultimaFoiCompleta;
+}
+
+bool AutoSalvamento::getFalhou() {
+    std::lock_guard<std::mutex> trava(mutex);
+    return falhou;
+}
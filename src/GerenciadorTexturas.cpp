@@ -0,0 +1,71 @@
+#include "../include/GerenciadorTexturas.hpp"
+#include "../include/Especies.hpp"
+#include "../include/Perfilador.hpp"
+#include <vector>
+
+GerenciadorTexturas::GerenciadorTexturas() {
+    for (auto& e : entradas) {
+        e.textura = Texture2D{};
+        e.referencias = 0;
+        e.carregada = false;
+    }
+}
+
+GerenciadorTexturas& GerenciadorTexturas::instancia() {
+    static GerenciadorTexturas gerenciador;
+    return gerenciador;
+}
+
+const char* GerenciadorTexturas::getCaminhoTextura(TipoOrganismo tipo) {
+    return getEspecie(tipo).caminhoTextura;
+}
+
+std::string GerenciadorTexturas::resolverCaminhoAsset(const std::string& relativo) {
+    std::vector<std::string> tentativas = {
+        relativo,
+        std::string("./") + relativo,
+        std::string("../") + relativo,
+        std::string("../../") + relativo
+    };
+    for (const auto& p : tentativas) {
+        if (FileExists(p.c_str())) return p;
+    }
+    return relativo; // fallback
+}
+
+const Texture2D* GerenciadorTexturas::adquirir(TipoOrganismo tipo) {
+    Entrada& e = entradas[static_cast<int>(tipo)];
+    e.referencias++;
+
+    if (!e.carregada) {
+        CronometroEscopo cronometro(SecaoPerfil::TEXTURAS);
+        std::string caminho = resolverCaminhoAsset(getCaminhoTextura(tipo));
+        if (FileExists(caminho.c_str())) {
+            e.textura = LoadTexture(caminho.c_str());
+        }
+        e.carregada = true;
+    }
+
+    return (e.textura.id != 0) ? &e.textura : nullptr;
+}
+
+void GerenciadorTexturas::liberar(TipoOrganismo tipo) {
+    Entrada& e = entradas[static_cast<int>(tipo)];
+    if (e.referencias <= 0) return;
+
+    e.referencias--;
+    if (e.referencias == 0 && e.carregada) {
+        if (e.textura.id != 0) UnloadTexture(e.textura);
+        e.textura = Texture2D{};
+        e.carregada = false;
+    }
+}
+
+const Texture2D* GerenciadorTexturas::obter(TipoOrganismo tipo) const {
+    const Entrada& e = entradas[static_cast<int>(tipo)];
+    return (e.carregada && e.textura.id != 0) ? &e.textura : nullptr;
+}
+
+int GerenciadorTexturas::getReferencias(TipoOrganismo tipo) const {
+    return entradas[static_cast<int>(tipo)].referencias;
+}
@@ -0,0 +1,59 @@
+#include "../include/IndiceAngular.hpp"
+#include <cmath>
+
+IndiceAngular::IndiceAngular(int n)
+    : numSetores(n > 0 ? n : NUM_SETORES_PADRAO),
+      setoresPorRadiano(numSetores / (2 * PI_F)),
+      setores(numSetores) {}
+
+int IndiceAngular::getSetor(float angulo) const {
+    // Filhos nascem até 30° antes/depois do pai, então o ângulo pode sair de [0, 2π)
+    float a = std::fmod(angulo, 2 * PI_F);
+    if (a < 0) a += 2 * PI_F;
+    int setor = static_cast<int>(a * setoresPorRadiano);
+    return setor < numSetores ? setor : numSetores - 1;
+}
+
+void IndiceAngular::colocarNoSetor(uint32_t slot, int setor) {
+    setorDoSlot[slot] = setor;
+    posicaoNoSetor[slot] = static_cast<uint32_t>(setores[setor].size());
+    setores[setor].push_back(slot);
+}
+
+void IndiceAngular::retirarDoSetor(uint32_t slot) {
+    std::vector<uint32_t>& lista = setores[setorDoSlot[slot]];
+    uint32_t posicao = posicaoNoSetor[slot];
+    uint32_t ultimo = lista.back();
+    lista[posicao] = ultimo;
+    posicaoNoSetor[ultimo] = posicao;
+    lista.pop_back();
+    setorDoSlot[slot] = SEM_SETOR;
+}
+
+void IndiceAngular::inserir(uint32_t slot, float angulo) {
+    if (slot >= setorDoSlot.size()) {
+        setorDoSlot.resize(slot + 1, SEM_SETOR);
+        posicaoNoSetor.resize(slot + 1, 0);
+    }
+    if (setorDoSlot[slot] != SEM_SETOR) retirarDoSetor(slot);
+    colocarNoSetor(slot, getSetor(angulo));
+}
+
+void IndiceAngular::remover(uint32_t slot) {
+    if (slot < setorDoSlot.size() && setorDoSlot[slot] != SEM_SETOR) {
+        retirarDoSetor(slot);
+    }
+}
+
+void IndiceAngular::atualizar(uint32_t slot, float angulo) {
+    int setor = getSetor(angulo);
+    if (setor == setorDoSlot[slot]) return;
+    retirarDoSetor(slot);
+    colocarNoSetor(slot, setor);
+}
+
+void IndiceAngular::limpar() {
+    for (auto& lista : setores) lista.clear();
+    setorDoSlot.clear();
+    posicaoNoSetor.clear();
+}
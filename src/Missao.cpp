@@ -1,4 +1,5 @@
 #include "../include/Missao.hpp"
+#include "../include/Perfilador.hpp"
 #include <cmath>
 
 Missao::Missao(TipoMissao t, ZonaPlaneta zona) 
@@ -338,6 +339,7 @@ void GestorMissoes::notificarAcaoManual(TipoMissao tipo) {
 }
 
 void GestorMissoes::atualizar(float deltaTime, const Populacao& pop, const Ambiente& ambiente) {
+    CronometroEscopo cronometro(SecaoPerfil::MISSOES);
     if (missaoAtual != nullptr) {
         missaoAtual->atualizar(deltaTime, pop, ambiente);
     }
@@ -356,4 +358,73 @@ bool GestorMissoes::todasMissoesCompletas() const {
 
 bool GestorMissoes::podeAvancarFase() const {
     return totalCompletadas >= missoes.size() / 2;
-}
\ No newline at end of file
+}
+
+ProgressoMissao Missao::getProgressoInterno() const {
+    ProgressoMissao p{};
+    p.estado = estado;
+    p.tempoDecorrido = tempoDecorrido;
+    p.tempoCondicao = tempoCondicao;
+    p.eventoFoiAtivado = eventoFoiAtivado;
+    p.acaoManualFeita = acaoManualFeita;
+    return p;
+}
+
+void Missao::setProgressoInterno(const ProgressoMissao& p) {
+    estado = p.estado;
+    tempoDecorrido = p.tempoDecorrido;
+    tempoCondicao = p.tempoCondicao;
+    eventoFoiAtivado = p.eventoFoiAtivado != 0;
+    acaoManualFeita = p.acaoManualFeita != 0;
+}
+
+// Valores soltos do GestorMissoes no snapshot
+struct EstadoGestorMissoes {
+    int32_t missaoAtual;   // índice em missoes, -1 = nenhuma
+    int32_t fase;
+    int32_t totalCompletadas;
+    int32_t pontuacaoTotal;
+};
+
+void GestorMissoes::salvarEstado(GravadorSnapshot& s, const std::string& p) const {
+    std::vector<TipoMissao> tipos;
+    std::vector<ZonaPlaneta> zonas;
+    std::vector<ProgressoMissao> progresso;
+    for (const Missao& m : missoes) {
+        tipos.push_back(m.getTipo());
+        zonas.push_back(m.getZonaAlvo());
+        progresso.push_back(m.getProgressoInterno());
+    }
+    EstadoGestorMissoes e{};
+    e.missaoAtual = missaoAtual ? static_cast<int32_t>(missaoAtual - missoes.data()) : -1;
+    e.fase = fase;
+    e.totalCompletadas = totalCompletadas;
+    e.pontuacaoTotal = pontuacaoTotal;
+    s.adicionarValor(p + "estado", e);
+    s.adicionarCopia(p + "tipos", tipos.data(), tipos.size() * sizeof(TipoMissao));
+    s.adicionarCopia(p + "zonas", zonas.data(), zonas.size() * sizeof(ZonaPlaneta));
+    s.adicionarCopia(p + "progresso", progresso.data(), progresso.size() * sizeof(ProgressoMissao));
+}
+
+bool GestorMissoes::carregarEstado(const LeitorSnapshot& s, const std::string& p) {
+    EstadoGestorMissoes e;
+    std::vector<TipoMissao> tipos;
+    std::vector<ZonaPlaneta> zonas;
+    std::vector<ProgressoMissao> progresso;
+    if (!s.lerValor(p + "estado", e) || !s.lerColuna(p + "tipos", tipos) || !s.lerColuna(p + "zonas", zonas) ||
+        !s.lerColuna(p + "progresso", progresso) || zonas.size() != tipos.size() ||
+        progresso.size() != tipos.size() || e.missaoAtual < -1 || e.missaoAtual >= static_cast<int32_t>(tipos.size())) {
+        return false;
+    }
+
+    missoes.clear();
+    for (size_t i = 0; i < tipos.size(); i++) {
+        missoes.emplace_back(tipos[i], zonas[i]);
+        missoes.back().setProgressoInterno(progresso[i]);
+    }
+    missaoAtual = e.missaoAtual >= 0 ? &missoes[e.missaoAtual] : nullptr;
+    fase = e.fase;
+    totalCompletadas = e.totalCompletadas;
+    pontuacaoTotal = e.pontuacaoTotal;
+    return true;
+}
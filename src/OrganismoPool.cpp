@@ -0,0 +1,219 @@
+#include "../include/OrganismoPool.hpp"
+
+void OrganismoPool::reservar(size_t capacidade) {
+    energia.reserve(capacidade);
+    energiaMaxima.reserve(capacidade);
+    resistenciaTermica.reserve(capacidade);
+    eficienciaMetabolica.reserve(capacidade);
+    velocidadeOrbital.reserve(capacidade);
+    anguloOrbital.reserve(capacidade);
+    vivo.reserve(capacidade);
+    categoria.reserve(capacidade);
+    tipo.reserve(capacidade);
+    zona.reserve(capacidade);
+    raioOrbital.reserve(capacidade);
+    idade.reserve(capacidade);
+    aptoReproducao.reserve(capacidade);
+    anguloAnterior.reserve(capacidade);
+    id.reserve(capacidade);
+    slotDaLinha.reserve(capacidade);
+    linhaDoSlot.reserve(capacidade);
+    geracaoDoSlot.reserve(capacidade);
+    slotsLivres.reserve(capacidade);
+}
+
+HandleOrganismo OrganismoPool::inserir(const Organismo& org) {
+    uint32_t linha = static_cast<uint32_t>(quantidade());
+
+    energia.push_back(org.getEnergia());
+    energiaMaxima.push_back(org.getEnergiaMaxima());
+    resistenciaTermica.push_back(org.getResistenciaTermica());
+    eficienciaMetabolica.push_back(org.getEficienciaMetabolica());
+    velocidadeOrbital.push_back(org.getVelocidadeOrbital());
+    anguloOrbital.push_back(org.getAnguloOrbital());
+    vivo.push_back(org.isVivo() ? 1 : 0);
+    categoria.push_back(org.getCategoria());
+    tipo.push_back(org.getTipo());
+    zona.push_back(org.getZona());
+    raioOrbital.push_back(org.getRaioOrbital());
+    idade.push_back(org.getIdade());
+    aptoReproducao.push_back(0);
+    anguloAnterior.push_back(org.getAnguloOrbital());
+    id.push_back((static_cast<uint64_t>(org.getZona()) + 1) << 56 | ++ultimoId);
+
+    uint32_t slot;
+    if (!slotsLivres.empty()) {
+        slot = slotsLivres.back();
+        slotsLivres.pop_back();
+        linhaDoSlot[slot] = linha;
+    } else {
+        slot = static_cast<uint32_t>(linhaDoSlot.size());
+        linhaDoSlot.push_back(linha);
+        geracaoDoSlot.push_back(0);
+    }
+    slotDaLinha.push_back(slot);
+
+    return HandleOrganismo{slot, geracaoDoSlot[slot]};
+}
+
+void OrganismoPool::moverLinha(size_t destino, size_t origem) {
+    energia[destino] = energia[origem];
+    energiaMaxima[destino] = energiaMaxima[origem];
+    resistenciaTermica[destino] = resistenciaTermica[origem];
+    eficienciaMetabolica[destino] = eficienciaMetabolica[origem];
+    velocidadeOrbital[destino] = velocidadeOrbital[origem];
+    anguloOrbital[destino] = anguloOrbital[origem];
+    vivo[destino] = vivo[origem];
+    categoria[destino] = categoria[origem];
+    tipo[destino] = tipo[origem];
+    zona[destino] = zona[origem];
+    raioOrbital[destino] = raioOrbital[origem];
+    idade[destino] = idade[origem];
+    aptoReproducao[destino] = aptoReproducao[origem];
+    anguloAnterior[destino] = anguloAnterior[origem];
+    id[destino] = id[origem];
+    slotDaLinha[destino] = slotDaLinha[origem];
+    linhaDoSlot[slotDaLinha[destino]] = static_cast<uint32_t>(destino);
+}
+
+size_t OrganismoPool::removerMortos() {
+    const size_t n = quantidade();
+    size_t fim = n;
+
+    // Cada morto é coberto pela última linha: só uma linha se move por morte
+    size_t i = 0;
+    while (i < fim) {
+        if (vivo[i]) {
+            i++;
+            continue;
+        }
+        uint32_t slot = slotDaLinha[i];
+        linhaDoSlot[slot] = HandleOrganismo::SLOT_INVALIDO;
+        geracaoDoSlot[slot]++;
+        slotsLivres.push_back(slot);
+
+        fim--;
+        if (i != fim) moverLinha(i, fim);
+    }
+
+    energia.resize(fim);
+    energiaMaxima.resize(fim);
+    resistenciaTermica.resize(fim);
+    eficienciaMetabolica.resize(fim);
+    velocidadeOrbital.resize(fim);
+    anguloOrbital.resize(fim);
+    vivo.resize(fim);
+    categoria.resize(fim);
+    tipo.resize(fim);
+    zona.resize(fim);
+    raioOrbital.resize(fim);
+    idade.resize(fim);
+    aptoReproducao.resize(fim);
+    anguloAnterior.resize(fim);
+    id.resize(fim);
+    slotDaLinha.resize(fim);
+
+    return n - fim;
+}
+
+void OrganismoPool::limpar() {
+    energia.clear();
+    energiaMaxima.clear();
+    resistenciaTermica.clear();
+    eficienciaMetabolica.clear();
+    velocidadeOrbital.clear();
+    anguloOrbital.clear();
+    vivo.clear();
+    categoria.clear();
+    tipo.clear();
+    zona.clear();
+    raioOrbital.clear();
+    idade.clear();
+    aptoReproducao.clear();
+    anguloAnterior.clear();
+    id.clear();
+    slotDaLinha.clear();
+
+    // Os slots continuam existindo (livres, com nova geração) para que
+    // handles guardados antes da limpeza não passem a valer para outro
+    slotsLivres.clear();
+    for (size_t s = linhaDoSlot.size(); s-- > 0;) {
+        if (linhaDoSlot[s] != HandleOrganismo::SLOT_INVALIDO) geracaoDoSlot[s]++;
+        linhaDoSlot[s] = HandleOrganismo::SLOT_INVALIDO;
+        slotsLivres.push_back(static_cast<uint32_t>(s));
+    }
+}
+
+bool OrganismoPool::contem(HandleOrganismo h) const {
+    return h.valido() && h.slot < linhaDoSlot.size() &&
+           linhaDoSlot[h.slot] != HandleOrganismo::SLOT_INVALIDO &&
+           geracaoDoSlot[h.slot] == h.geracao;
+}
+
+void OrganismoPool::salvarEstado(GravadorSnapshot& s, const std::string& p) const {
+    s.adicionarColuna(p + "energia", energia);
+    s.adicionarColuna(p + "energiaMaxima", energiaMaxima);
+    s.adicionarColuna(p + "resistenciaTermica", resistenciaTermica);
+    s.adicionarColuna(p + "eficienciaMetabolica", eficienciaMetabolica);
+    s.adicionarColuna(p + "velocidadeOrbital", velocidadeOrbital);
+    s.adicionarColuna(p + "anguloOrbital", anguloOrbital);
+    s.adicionarColuna(p + "vivo", vivo);
+    s.adicionarColuna(p + "categoria", categoria);
+    s.adicionarColuna(p + "tipo", tipo);
+    s.adicionarColuna(p + "zona", zona);
+    s.adicionarColuna(p + "raioOrbital", raioOrbital);
+    s.adicionarColuna(p + "idade", idade);
+    s.adicionarColuna(p + "aptoReproducao", aptoReproducao);
+    s.adicionarColuna(p + "anguloAnterior", anguloAnterior);
+    s.adicionarColuna(p + "id", id);
+    s.adicionarColuna(p + "linhaDoSlot", linhaDoSlot);
+    s.adicionarColuna(p + "geracaoDoSlot", geracaoDoSlot);
+    s.adicionarColuna(p + "slotDaLinha", slotDaLinha);
+    s.adicionarColuna(p + "slotsLivres", slotsLivres);
+    s.adicionarValor(p + "ultimoId", ultimoId);
+}
+
+bool OrganismoPool::carregarEstado(const LeitorSnapshot& s, const std::string& p, ZonaPlaneta zonaPool) {
+    bool ok = s.lerColuna(p + "energia", energia) &&
+              s.lerColuna(p + "energiaMaxima", energiaMaxima) &&
+              s.lerColuna(p + "resistenciaTermica", resistenciaTermica) &&
+              s.lerColuna(p + "eficienciaMetabolica", eficienciaMetabolica) &&
+              s.lerColuna(p + "velocidadeOrbital", velocidadeOrbital) &&
+              s.lerColuna(p + "anguloOrbital", anguloOrbital) &&
+              s.lerColuna(p + "vivo", vivo) &&
+              s.lerColuna(p + "categoria", categoria) &&
+              s.lerColuna(p + "tipo", tipo) &&
+              s.lerColuna(p + "zona", zona) &&
+              s.lerColuna(p + "raioOrbital", raioOrbital) &&
+              s.lerColuna(p + "idade", idade) &&
+              s.lerColuna(p + "aptoReproducao", aptoReproducao) &&
+              s.lerColuna(p + "anguloAnterior", anguloAnterior) &&
+              s.lerColuna(p + "id", id) &&
+              s.lerColuna(p + "linhaDoSlot", linhaDoSlot) &&
+              s.lerColuna(p + "geracaoDoSlot", geracaoDoSlot) &&
+              s.lerColuna(p + "slotDaLinha", slotDaLinha) &&
+              s.lerColuna(p + "slotsLivres", slotsLivres) &&
+              s.lerValor(p + "ultimoId", ultimoId);
+
+    // Todas as colunas com uma linha por organismo e a indireção coerente
+    const size_t n = tipo.size();
+    ok = ok && energia.size() == n && energiaMaxima.size() == n && resistenciaTermica.size() == n &&
+         eficienciaMetabolica.size() == n && velocidadeOrbital.size() == n && anguloOrbital.size() == n &&
+         vivo.size() == n && categoria.size() == n && zona.size() == n && raioOrbital.size() == n &&
+         idade.size() == n && aptoReproducao.size() == n && anguloAnterior.size() == n && id.size() == n &&
+         slotDaLinha.size() == n && geracaoDoSlot.size() == linhaDoSlot.size();
+    for (size_t linha = 0; ok && linha < n; linha++) {
+        ok = slotDaLinha[linha] < linhaDoSlot.size() && linhaDoSlot[slotDaLinha[linha]] == linha;
+    }
+    // Tipo e categoria indexam tabelas (ESPECIES, estatísticas, TracosCategoria)
+    for (size_t linha = 0; ok && linha < n; linha++) {
+        ok = static_cast<unsigned>(tipo[linha]) < NUM_TIPOS_ORGANISMO &&
+             (categoria[linha] == TipoCategoria::PLANTA || categoria[linha] == TipoCategoria::REAGENTE) &&
+             zona[linha] == zonaPool;
+    }
+    for (size_t i = 0; ok && i < slotsLivres.size(); i++) {
+        ok = slotsLivres[i] < linhaDoSlot.size() && linhaDoSlot[slotsLivres[i]] == HandleOrganismo::SLOT_INVALIDO;
+    }
+    if (!ok) limpar();
+    return ok;
+}
@@ -0,0 +1,58 @@
+#include "../include/ParametrosSimulacao.hpp"
+
+static const char* NOMES_ZONAS[NUM_ZONAS] = { "NUCLEO", "HABITAVEL", "PERIFERIA" };
+static const char* NOMES_CATEGORIAS[2] = { "PLANTA", "REAGENTE" };
+
+ParametrosSimulacao::ParametrosSimulacao() {
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        zonas[z] = Ambiente::getCondicoesPadrao(static_cast<ZonaPlaneta>(z));
+    }
+}
+
+float* ParametrosSimulacao::localizar(const std::string& nome) {
+    size_t ponto = nome.find('.');
+    if (ponto == std::string::npos) return nullptr;
+    std::string grupo = nome.substr(0, ponto);
+    std::string campo = nome.substr(ponto + 1);
+
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        if (grupo != NOMES_ZONAS[z]) continue;
+        if (campo == "temperaturaBase") return &zonas[z].temperaturaBase;
+        if (campo == "nivelRecursosBase") return &zonas[z].nivelRecursosBase;
+        if (campo == "taxaConsumo") return &zonas[z].taxaConsumo;
+        return nullptr;
+    }
+    for (int c = 0; c < 2; c++) {
+        if (grupo != NOMES_CATEGORIAS[c]) continue;
+        if (campo == "chanceReproducao") return &reproducao.chance[c];
+        if (campo == "cooldownReproducao") return &reproducao.cooldown[c];
+        return nullptr;
+    }
+    if (grupo == "mutacao") {
+        if (campo == "eficiencia") return &mutacao.eficiencia;
+        if (campo == "resistencia") return &mutacao.resistencia;
+        if (campo == "velocidade") return &mutacao.velocidade;
+        if (campo == "energiaMaxima") return &mutacao.energiaMaxima;
+    }
+    if (grupo == "zona" && campo == "populacaoMaxima") return &populacaoMaximaZona;
+    return nullptr;
+}
+
+std::vector<std::string> ParametrosSimulacao::getNomes() {
+    std::vector<std::string> nomes;
+    for (const char* zona : NOMES_ZONAS) {
+        for (const char* campo : { "temperaturaBase", "nivelRecursosBase", "taxaConsumo" }) {
+            nomes.push_back(std::string(zona) + "." + campo);
+        }
+    }
+    for (const char* categoria : NOMES_CATEGORIAS) {
+        for (const char* campo : { "chanceReproducao", "cooldownReproducao" }) {
+            nomes.push_back(std::string(categoria) + "." + campo);
+        }
+    }
+    for (const char* campo : { "eficiencia", "resistencia", "velocidade", "energiaMaxima" }) {
+        nomes.push_back(std::string("mutacao.") + campo);
+    }
+    nomes.push_back("zona.populacaoMaxima");
+    return nomes;
+}
@@ -0,0 +1,119 @@
+#include "../include/Perfilador.hpp"
+#include <algorithm>
+
+static const struct { const char* nome; int nivel; bool agregado; } SECOES[NUM_SECOES_PERFIL] = {
+    { "entrada", 0, false },
+    { "simulacao", 0, true },
+    { "ambiente", 1, false },
+    { "organismos", 1, false },
+    { "temporizadores", 1, false },
+    { "selecao natural", 1, false },
+    { "reproducao", 1, false },
+    { "remocao de mortos", 1, false },
+    { "missoes", 1, false },
+    { "autosave", 0, false },
+    { "texturas", 0, false },
+    { "renderizacao", 0, true },
+    { "estrelas", 1, false },
+    { "interface pc", 1, false },
+    { "tela inicial", 1, false },
+    { "jogo", 1, true },
+    { "planeta", 2, false },
+    { "organismos", 2, false },
+    { "inspecao", 2, false },
+    { "interface", 2, false },
+    { "menu eventos", 1, false },
+    { "menu missoes", 1, false },
+    { "catalogo", 1, false },
+    { "game over", 1, false },
+    { "final", 1, false },
+};
+
+Perfilador::Perfilador() : ativo(false) {
+    for (auto& a : acumulado) a.store(0);
+    limpar();
+}
+
+Perfilador& Perfilador::instancia() {
+    static Perfilador perfilador;
+    return perfilador;
+}
+
+void Perfilador::limpar() {
+    for (auto& a : acumulado) a.store(0, std::memory_order_relaxed);
+    for (auto& linha : historico) std::fill(std::begin(linha), std::end(linha), 0.0f);
+    posicao = 0;
+    preenchidos = 0;
+    totalQuadros = 0;
+    temPico = false;
+}
+
+void Perfilador::fecharQuadro(float segundosQuadro) {
+    const float quadroMs = segundosQuadro * 1000.0f;
+    // Mediana antes de o quadro entrar, para ele não diluir o próprio pico
+    const float mediana = preenchidos >= JANELA / 4 ? calcularPercentis(NUM_SECOES_PERFIL).p50 : 0.0f;
+
+    for (int s = 0; s < NUM_SECOES_PERFIL; s++) {
+        uint64_t ns = acumulado[s].exchange(0, std::memory_order_relaxed);
+        historico[s][posicao] = static_cast<float>(ns * 1e-6);
+    }
+    historico[NUM_SECOES_PERFIL][posicao] = quadroMs;
+
+    if (mediana > 0 && quadroMs > LIMIAR_PICO * mediana) {
+        ultimoPico.quadro = totalQuadros;
+        ultimoPico.quadroMs = quadroMs;
+        for (int s = 0; s < NUM_SECOES_PERFIL; s++) ultimoPico.secoesMs[s] = historico[s][posicao];
+        temPico = true;
+    }
+
+    posicao = (posicao + 1) % JANELA;
+    preenchidos = std::min(preenchidos + 1, JANELA);
+    totalQuadros++;
+}
+
+Perfilador::Percentis Perfilador::calcularPercentis(int linha) const {
+    Percentis p;
+    if (preenchidos == 0) return p;
+    p.ultimo = historico[linha][(posicao + JANELA - 1) % JANELA];
+
+    // Ordem não importa para percentis: a janela preenchida é o começo do
+    // buffer até encher, e o buffer inteiro depois
+    float valores[JANELA];
+    std::copy(historico[linha], historico[linha] + preenchidos, valores);
+    auto percentil = [&](float q) {
+        int k = std::min(preenchidos - 1, static_cast<int>(q * preenchidos));
+        std::nth_element(valores, valores + k, valores + preenchidos);
+        return valores[k];
+    };
+    p.p50 = percentil(0.50f);
+    p.p95 = percentil(0.95f);
+    p.p99 = percentil(0.99f);
+    return p;
+}
+
+Perfilador::Percentis Perfilador::getPercentis(SecaoPerfil secao) const {
+    return calcularPercentis(static_cast<int>(secao));
+}
+
+Perfilador::Percentis Perfilador::getPercentisQuadro() const {
+    return calcularPercentis(NUM_SECOES_PERFIL);
+}
+
+void Perfilador::copiarHistoricoQuadro(std::vector<float>& destino) const {
+    destino.clear();
+    const float* quadros = historico[NUM_SECOES_PERFIL];
+    int inicio = preenchidos < JANELA ? 0 : posicao;
+    for (int i = 0; i < preenchidos; i++) destino.push_back(quadros[(inicio + i) % JANELA]);
+}
+
+const char* Perfilador::getNome(SecaoPerfil secao) {
+    return SECOES[static_cast<int>(secao)].nome;
+}
+
+int Perfilador::getNivel(SecaoPerfil secao) {
+    return SECOES[static_cast<int>(secao)].nivel;
+}
+
+bool Perfilador::isAgregado(SecaoPerfil secao) {
+    return SECOES[static_cast<int>(secao)].agregado;
+}
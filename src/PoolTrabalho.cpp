@@ -0,0 +1,74 @@
+#include "../include/PoolTrabalho.hpp"
+
+PoolTrabalho::PoolTrabalho(int numThreads)
+    : tarefa(nullptr), totalIndices(0), proximoIndice(0),
+      pendentes(0), lote(0), encerrando(false) {
+    for (int i = 0; i < numThreads; i++) {
+        threads.emplace_back(&PoolTrabalho::lacoTrabalhador, this);
+    }
+}
+
+PoolTrabalho::~PoolTrabalho() {
+    {
+        std::lock_guard<std::mutex> trava(mutex);
+        encerrando = true;
+    }
+    cvInicio.notify_all();
+    for (auto& t : threads) {
+        t.join();
+    }
+}
+
+void PoolTrabalho::consumirIndices() {
+    int i;
+    while ((i = proximoIndice.fetch_add(1)) < totalIndices) {
+        (*tarefa)(i);
+    }
+}
+
+void PoolTrabalho::lacoTrabalhador() {
+    uint64_t ultimoLote = 0;
+    for (;;) {
+        {
+            std::unique_lock<std::mutex> trava(mutex);
+            cvInicio.wait(trava, [&] { return encerrando || lote != ultimoLote; });
+            if (encerrando) return;
+            ultimoLote = lote;
+        }
+
+        consumirIndices();
+
+        bool ultima;
+        {
+            std::lock_guard<std::mutex> trava(mutex);
+            ultima = (--pendentes == 0);
+        }
+        if (ultima) cvFim.notify_one();
+    }
+}
+
+void PoolTrabalho::executar(int n, const std::function<void(int)>& t) {
+    if (n <= 0) return;
+
+    // Sem threads auxiliares (ou só um índice): roda direto na chamadora
+    if (threads.empty() || n == 1) {
+        for (int i = 0; i < n; i++) t(i);
+        return;
+    }
+
+    {
+        std::lock_guard<std::mutex> trava(mutex);
+        tarefa = &t;
+        totalIndices = n;
+        proximoIndice.store(0);
+        pendentes = static_cast<int>(threads.size());
+        lote++;
+    }
+    cvInicio.notify_all();
+
+    consumirIndices();
+
+    std::unique_lock<std::mutex> trava(mutex);
+    cvFim.wait(trava, [&] { return pendentes == 0; });
+    tarefa = nullptr;
+}
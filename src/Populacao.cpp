@@ -1,86 +1,311 @@
 #include "../include/Populacao.hpp"
+#include "../include/Especies.hpp"
+#include "../include/Perfilador.hpp"
 #include <algorithm>
-#include <cstdlib>
+#include <cmath>
+
+// Relógios biológicos em segundos de simulação
+static constexpr float INTERVALO_ENVELHECIMENTO = 1.0f;
+
+// Resolução da RodaTemporal: um passo da roda = 1/60 s de simulação,
+// qualquer que seja a taxa de tick
+static constexpr double PASSOS_RODA_POR_SEGUNDO = 60.0;
+
+enum TipoTemporizador : uint8_t {
+    TEMPORIZADOR_ENVELHECER,
+    TEMPORIZADOR_FIM_COOLDOWN
+};
+
+static uint64_t passosRoda(float segundos) {
+    return static_cast<uint64_t>(std::ceil(segundos * PASSOS_RODA_POR_SEGUNDO - 1e-6));
+}
+
+// As chances de morte e de reprodução foram calibradas quando a simulação
+// rodava um tick por quadro a 60 FPS. Convertê-las para a duração do passo
+// mantém a mesma probabilidade por segundo em qualquer taxa de tick.
+static float chancePorPasso(float chanceA60Hz, float deltaTime) {
+    if (chanceA60Hz >= 1.0f) return 1.0f;
+    return 1.0f - std::pow(1.0f - chanceA60Hz, deltaTime * 60.0f);
+}
 
 Populacao::Populacao() 
-    : totalNascimentos(0), totalMortes(0), geracao(0), populacaoMaxima(60) {}
+    : tempoSimulado(0), anotarNascimentos(false), totalNascimentos(0), totalMortes(0), geracao(0), populacaoMaxima(ParametrosSimulacao::POPULACAO_MAXIMA_ZONA_PADRAO) {
+    organismos.reservar(populacaoMaxima);
+}
 
 Populacao::~Populacao() {
     limpar();
 }
 
-void Populacao::adicionarOrganismo(TipoOrganismo tipo, ZonaPlaneta zona, float angulo, float raio) {
-    if (organismos.size() < populacaoMaxima) {
-        organismos.push_back(std::make_unique<Organismo>(tipo, zona, angulo, raio));
-        totalNascimentos++;
+void Populacao::setPopulacaoMaxima(int maxima) {
+    populacaoMaxima = std::max(1, maxima);
+    organismos.reservar(populacaoMaxima);
+}
+
+HandleOrganismo Populacao::adicionarOrganismo(TipoOrganismo tipo, ZonaPlaneta zona, float angulo, float raio) {
+    if (organismos.quantidade() < (size_t)populacaoMaxima) {
+        return inserirOrganismo(Organismo(tipo, zona, angulo, raio));
     }
+    return HandleOrganismo{};
 }
 
-void Populacao::removerMortos() {
-    auto it = std::remove_if(organismos.begin(), organismos.end(),
-        [this](const std::unique_ptr<Organismo>& org) {
-            if (!org->isVivo()) {
-                totalMortes++;
-                return true;
-            }
-            return false;
-        });
-    
-    organismos.erase(it, organismos.end());
+HandleOrganismo Populacao::inserirOrganismo(const Organismo& org, IdOrganismo idPai) {
+    totalNascimentos++;
+    estatisticas.registrarNascimento(org.getTipo(), org.getCategoria(), org.getZona(),
+                                     org.getEnergia(), org.getIdade());
+    HandleOrganismo h = organismos.inserir(org);
+    indice.inserir(h.slot, org.getAnguloOrbital());
+    if (anotarNascimentos) {
+        IdOrganismo id = organismos.id[organismos.getLinha(h)];
+        nascimentosPendentes.push_back(RegistroLinhagem::descreverNascimento(org, id, idPai));
+    }
+
+    // Os temporizadores levam o handle: os de um antigo dono do slot são
+    // recusados pela geração
+    roda.agendar(roda.getAgora() + passosRoda(INTERVALO_ENVELHECIMENTO), h.slot, h.geracao, TEMPORIZADOR_ENVELHECER);
+    agendarFimCooldown(h, org.getCategoria());
+    return h;
 }
 
-void Populacao::processarReproducao() {
-    novaGeracao.clear();
-    
-    for (auto& org : organismos) {
-        if (org->podeReproduzir()) {
-            Organismo* filho = org->reproduzir();
-            if (filho != nullptr) {
-                novaGeracao.push_back(std::unique_ptr<Organismo>(filho));
+void Populacao::agendarFimCooldown(HandleOrganismo h, TipoCategoria categoria) {
+    float cooldown = reproducao.cooldown[static_cast<int>(categoria)];
+    roda.agendar(roda.getAgora() + passosRoda(cooldown), h.slot, h.geracao, TEMPORIZADOR_FIM_COOLDOWN);
+}
+
+void Populacao::processarTemporizadores(float deltaTime) {
+    CronometroEscopo cronometro(SecaoPerfil::TEMPORIZADORES);
+    tempoSimulado += deltaTime;
+    const uint64_t alvo = static_cast<uint64_t>(tempoSimulado * PASSOS_RODA_POR_SEGUNDO + 1e-6);
+    while (roda.getAgora() < alvo) {
+        roda.avancar([this](const Temporizador& t) { dispararTemporizador(t); });
+    }
+}
+
+void Populacao::dispararTemporizador(const Temporizador& t) {
+    // Organismo morreu (e talvez o slot já tenha outro dono): nada a fazer
+    HandleOrganismo h{t.alvo, t.geracao};
+    if (!organismos.contem(h)) return;
+    size_t i = organismos.getLinha(h);
+    if (!organismos.vivo[i]) return;
+
+    switch (t.tipo) {
+        case TEMPORIZADOR_ENVELHECER:
+            // Um ano de idade por segundo de simulação
+            envelhecer(i);
+            if (organismos.vivo[i]) {
+                roda.agendar(roda.getAgora() + passosRoda(INTERVALO_ENVELHECIMENTO), t.alvo, t.geracao,
+                             TEMPORIZADOR_ENVELHECER);
             }
-        }
+            break;
+        case TEMPORIZADOR_FIM_COOLDOWN:
+            organismos.aptoReproducao[i] = 1;
+            aptosReproducao.push_back(t);
+            break;
     }
-    
-    // Adicionar nova geração
-    for (auto& filho : novaGeracao) {
-        if (organismos.size() < populacaoMaxima) {
-            organismos.push_back(std::move(filho));
-            totalNascimentos++;
+}
+
+void Populacao::morrer(size_t i) {
+    if (!organismos.vivo[i]) return;
+    organismos.vivo[i] = 0;
+    indice.remover(organismos.getHandle(i).slot);
+    estatisticas.registrarMorte(organismos.tipo[i], organismos.categoria[i], organismos.zona[i],
+                                organismos.energia[i], organismos.idade[i]);
+}
+
+void Populacao::removerMortos() {
+    CronometroEscopo cronometro(SecaoPerfil::REMOCAO_MORTOS);
+    totalMortes += static_cast<int>(organismos.removerMortos());
+}
+
+void Populacao::processarReproducao(float deltaTime) {
+    CronometroEscopo cronometro(SecaoPerfil::REPRODUCAO);
+    // Só os organismos com cooldown vencido são visitados. Os filhos entram
+    // direto no fim das colunas do pool (capacidade já reservada para
+    // populacaoMaxima) e não estão na lista. Entradas de quem morreu ou já
+    // reproduziu são descartadas aqui mesmo.
+    bool houveReproducao = false;
+    size_t mantidos = 0;
+    for (size_t k = 0; k < aptosReproducao.size(); k++) {
+        const Temporizador& t = aptosReproducao[k];
+        HandleOrganismo h{t.alvo, t.geracao};
+        if (!organismos.contem(h)) continue;
+        size_t i = organismos.getLinha(h);
+        if (!organismos.vivo[i] || !organismos.aptoReproducao[i]) continue;
+
+        if (podeReproduzir(i, deltaTime)) {
+            reproduzir(i);
+            houveReproducao = true;
+            continue;
         }
+        aptosReproducao[mantidos++] = t;
     }
+    aptosReproducao.resize(mantidos);
     
-    if (novaGeracao.size() > 0) {
+    if (houveReproducao) {
         geracao++;
     }
 }
 
-void Populacao::aplicarSelecaoNatural(const Ambiente& ambiente) {
+void Populacao::aplicarSelecaoNatural(const Ambiente& ambiente, float deltaTime) {
+    CronometroEscopo cronometro(SecaoPerfil::SELECAO_NATURAL);
     // Organismos mal adaptados têm maior chance de morrer
-    for (auto& org : organismos) {
-        if (!org->isVivo()) continue;
+    const float temperatura = ambiente.getTemperatura();
+    const size_t n = organismos.quantidade();
+    const float* resistencia = organismos.resistenciaTermica.data();
+    uint8_t* vivo = organismos.vivo.data();
+
+    for (size_t i = 0; i < n; i++) {
+        if (!vivo[i]) continue;
         
-        float adaptacao = std::abs(org->getResistenciaTermica() - ambiente.getTemperatura());
+        float adaptacao = std::abs(resistencia[i] - temperatura);
         
         // Se muito mal adaptado, chance de morte
         if (adaptacao > 0.4f) {
-            if ((rand() % 100) < (adaptacao * 50)) {
-                org->setVivo(false);
+            if (gerador.sortear(chancePorPasso(std::min(1.0f, adaptacao * 0.5f), deltaTime))) {
+                morrer(i);
             }
         }
     }
 }
 
+template <TipoCategoria C>
+float Populacao::atualizarOrganismo(size_t i, float deltaTime, float temperaturaZona, float recursosZona,
+                                     float fatorConsumo) {
+    using Tracos = TracosCategoria<C>;
+    const float eficiencia = organismos.eficienciaMetabolica[i];
+
+    // Consumo de energia base, escalado pela taxa de consumo da zona
+    float e = organismos.energia[i] - (2.0f - eficiencia) * fatorConsumo * deltaTime;
+    if (e < 0) e = 0;
+
+    // Efeito da temperatura
+    float diferencaTermica = std::abs(temperaturaZona - organismos.resistenciaTermica[i]);
+    if (diferencaTermica > 0.2f) {
+        e -= diferencaTermica * 25.0f * deltaTime;
+        if (e < 0) e = 0;
+    }
+
+    // Absorção de recursos
+    if constexpr (Tracos::ABSORVE_RECURSOS) {
+        e += recursosZona * eficiencia * deltaTime * 0.5f;
+        if (e > organismos.energiaMaxima[i]) e = organismos.energiaMaxima[i];
+    }
+    organismos.energia[i] = e;
+
+    // Movimento
+    if constexpr (Tracos::SE_MOVE) {
+        float& angulo = organismos.anguloOrbital[i];
+        angulo += organismos.velocidadeOrbital[i] * deltaTime * 0.1f;
+        if (angulo > 2 * PI_F) angulo -= 2 * PI_F;
+        indice.atualizar(organismos.getHandle(i).slot, angulo);
+    }
+    return e;
+}
+
+void Populacao::atualizarOrganismos(float deltaTime, float temperaturaZona, float recursosZona,
+                                    float fatorConsumo) {
+    CronometroEscopo cronometro(SecaoPerfil::ORGANISMOS);
+    const size_t n = organismos.quantidade();
+    uint8_t* vivo = organismos.vivo.data();
+    const TipoCategoria* categoria = organismos.categoria.data();
+
+    // Estado anterior para a renderização interpolar entre dois ticks
+    std::copy(organismos.anguloOrbital.begin(), organismos.anguloOrbital.end(),
+              organismos.anguloAnterior.begin());
+
+    // Energia total e extremos dos sobreviventes, de carona nesta passada
+    double somaEnergia = 0.0;
+    float energiaMin = 0.0f;
+    float energiaMax = 0.0f;
+    bool primeiro = true;
+
+    for (size_t i = 0; i < n; i++) {
+        if (!vivo[i]) continue;
+
+        // Um único desvio por organismo escolhe a versão da categoria
+        float e = (categoria[i] == TipoCategoria::PLANTA)
+            ? atualizarOrganismo<TipoCategoria::PLANTA>(i, deltaTime, temperaturaZona, recursosZona, fatorConsumo)
+            : atualizarOrganismo<TipoCategoria::REAGENTE>(i, deltaTime, temperaturaZona, recursosZona, fatorConsumo);
+
+        // Morte por falta de energia
+        if (e <= 0) {
+            morrer(i);
+        }
+
+        if (vivo[i]) {
+            somaEnergia += e;
+            if (primeiro || e < energiaMin) energiaMin = e;
+            if (primeiro || e > energiaMax) energiaMax = e;
+            primeiro = false;
+        }
+    }
+    estatisticas.somaEnergia = somaEnergia;
+    estatisticas.energiaMinima = energiaMin;
+    estatisticas.energiaMaxima = energiaMax;
+}
+
+void Populacao::envelhecer(size_t i) {
+    organismos.idade[i]++;
+    estatisticas.registrarEnvelhecimento();
+    
+    // Organismos mais velhos são menos eficientes
+    organismos.eficienciaMetabolica[i] *= 0.99f;
+    
+    // Morte por velhice (probabilidade aumenta com idade)
+    int idadeMaxima = getEspecie(organismos.tipo[i]).idadeMaxima;
+    if (organismos.idade[i] > idadeMaxima && gerador.inteiro(100) < 20) {
+        morrer(i);
+    }
+}
+
+bool Populacao::podeReproduzir(size_t i, float deltaTime) {
+    if (!organismos.vivo[i]) return false;
+
+    // Cooldown (vencido pela RodaTemporal)
+    if (!organismos.aptoReproducao[i]) return false;
+
+    // Precisa estar bem alimentado
+    if (organismos.energia[i] < organismos.energiaMaxima[i] * 0.75f) return false;
+
+    // Chance (evita explosão populacional)
+    float chance = reproducao.chance[static_cast<int>(organismos.categoria[i])];
+    return gerador.sortear(chancePorPasso(chance, deltaTime));
+}
+
+void Populacao::reproduzir(size_t i) {
+    // Consumir energia para reprodução
+    estatisticas.registrarVariacaoEnergia(-0.4f * organismos.energia[i]);
+    organismos.energia[i] *= 0.6f;
+    organismos.aptoReproducao[i] = 0;
+    agendarFimCooldown(organismos.getHandle(i), organismos.categoria[i]);
+    
+    // Zona lotada: o custo é pago, mas o filho não chega a ser criado
+    if (organismos.quantidade() >= (size_t)populacaoMaxima) return;
+    
+    // Criar novo organismo próximo
+    float novoAngulo = organismos.anguloOrbital[i] + ((gerador.inteiro(60) - 30) * GRAUS_PARA_RAD);
+    float novoRaio = organismos.raioOrbital[i] + ((gerador.inteiro(20) - 10));
+    
+    Organismo filho(organismos.tipo[i], organismos.zona[i], novoAngulo, novoRaio);
+    
+    // Aplicar mutação
+    filho.aplicarMutacao(gerador, mutacao);
+    
+    inserirOrganismo(filho, organismos.id[i]);
+}
+
 void Populacao::atualizar(float deltaTime, const Ambiente& ambiente) {
     // Atualizar todos os organismos
-    for (auto& org : organismos) {
-        org->atualizar(deltaTime, ambiente.getTemperatura(), ambiente.getNivelRecursos());
-    }
+    atualizarOrganismos(deltaTime, ambiente.getTemperatura(), ambiente.getNivelRecursos(), ambiente.getFatorConsumo());
+    
+    // Envelhecimento e fim de cooldown que vencem neste tick
+    processarTemporizadores(deltaTime);
     
     // Aplicar seleção natural
-    aplicarSelecaoNatural(ambiente);
+    aplicarSelecaoNatural(ambiente, deltaTime);
     
     // Processar reprodução
-    processarReproducao();
+    processarReproducao(deltaTime);
     
     // Remover mortos
     removerMortos();
@@ -89,20 +314,19 @@ void Populacao::atualizar(float deltaTime, const Ambiente& ambiente) {
     // para evitar softlock quando o jogador elimina todos.
     //
     // Observação: este projeto usa TipoCategoria (Organismo.hpp). Não existe "CategoriaOrganismo".
-    if (organismos.empty()) {
+    if (organismos.vazio()) {
         ZonaPlaneta zona = ambiente.getZona();
 
         auto gerarSeed = [&](TipoOrganismo tipo) {
             // posição orbital coerente com a zona
-            float angulo = (float)(GetRandomValue(0, 359) * DEG2RAD);
+            float angulo = gerador.inteiro(360) * GRAUS_PARA_RAD;
             float raio = 0.0f;
             switch (zona) {
-                case ZonaPlaneta::NUCLEO:     raio = 50.0f  + GetRandomValue(0, 40);  break;
-                case ZonaPlaneta::HABITAVEL:  raio = 150.0f + GetRandomValue(0, 60);  break;
-                case ZonaPlaneta::PERIFERIA:  raio = 270.0f + GetRandomValue(0, 80);  break;
+                case ZonaPlaneta::NUCLEO:     raio = 50.0f  + gerador.inteiro(41);  break;
+                case ZonaPlaneta::HABITAVEL:  raio = 150.0f + gerador.inteiro(61);  break;
+                case ZonaPlaneta::PERIFERIA:  raio = 270.0f + gerador.inteiro(81);  break;
             }
-            organismos.push_back(std::make_unique<Organismo>(tipo, zona, angulo, raio));
-            totalNascimentos++;
+            inserirOrganismo(Organismo(tipo, zona, angulo, raio));
         };
 
         // 1 Planta + 1 Reagente, por zona
@@ -110,16 +334,16 @@ void Populacao::atualizar(float deltaTime, const Ambiente& ambiente) {
         TipoOrganismo reagente = TipoOrganismo::ORBITON;
         switch (zona) {
             case ZonaPlaneta::NUCLEO:
-                planta = (GetRandomValue(0, 1) == 0) ? TipoOrganismo::PYROSYNTH : TipoOrganismo::RUBRAFLORA;
-                reagente = (GetRandomValue(0, 1) == 0) ? TipoOrganismo::IGNIVAR : TipoOrganismo::VOLTREX;
+                planta = (gerador.inteiro(2) == 0) ? TipoOrganismo::PYROSYNTH : TipoOrganismo::RUBRAFLORA;
+                reagente = (gerador.inteiro(2) == 0) ? TipoOrganismo::IGNIVAR : TipoOrganismo::VOLTREX;
                 break;
             case ZonaPlaneta::HABITAVEL:
-                planta = (GetRandomValue(0, 1) == 0) ? TipoOrganismo::LUMIVINE : TipoOrganismo::AEROFLORA;
-                reagente = (GetRandomValue(0, 1) == 0) ? TipoOrganismo::ORBITON : TipoOrganismo::SYNAPSEX;
+                planta = (gerador.inteiro(2) == 0) ? TipoOrganismo::LUMIVINE : TipoOrganismo::AEROFLORA;
+                reagente = (gerador.inteiro(2) == 0) ? TipoOrganismo::ORBITON : TipoOrganismo::SYNAPSEX;
                 break;
             case ZonaPlaneta::PERIFERIA:
-                planta = (GetRandomValue(0, 1) == 0) ? TipoOrganismo::CRYOMOSS : TipoOrganismo::GELIBLOOM;
-                reagente = (GetRandomValue(0, 1) == 0) ? TipoOrganismo::NULLWALKER : TipoOrganismo::HUSKLING;
+                planta = (gerador.inteiro(2) == 0) ? TipoOrganismo::CRYOMOSS : TipoOrganismo::GELIBLOOM;
+                reagente = (gerador.inteiro(2) == 0) ? TipoOrganismo::NULLWALKER : TipoOrganismo::HUSKLING;
                 break;
         }
         gerarSeed(planta);
@@ -128,68 +352,78 @@ void Populacao::atualizar(float deltaTime, const Ambiente& ambiente) {
 }
 
 int Populacao::contarPorZona(ZonaPlaneta zona) const {
-    int count = 0;
-    for (const auto& org : organismos) {
-        if (org->getZona() == zona && org->isVivo()) {
-            count++;
-        }
-    }
-    return count;
+    return estatisticas.porZona[static_cast<int>(zona)];
 }
 
 int Populacao::contarPorTipo(TipoOrganismo tipo) const {
-    int count = 0;
-    for (const auto& org : organismos) {
-        if (org->getTipo() == tipo && org->isVivo()) {
-            count++;
-        }
-    }
-    return count;
+    return estatisticas.porTipo[static_cast<int>(tipo)];
 }
 
 float Populacao::energiaMedia() const {
-    if (organismos.empty()) return 0;
-    
-    float total = 0;
-    int count = 0;
-    for (const auto& org : organismos) {
-        if (org->isVivo()) {
-            total += org->getEnergia();
-            count++;
-        }
-    }
-    return count > 0 ? total / count : 0;
+    return estatisticas.energiaMedia();
 }
 
 float Populacao::idadeMedia() const {
-    if (organismos.empty()) return 0;
-    
-    float total = 0;
-    int count = 0;
-    for (const auto& org : organismos) {
-        if (org->isVivo()) {
-            total += org->getIdade();
-            count++;
+    return estatisticas.idadeMedia();
+}
+
+void Populacao::buscarVizinhos(float angulo, float raio, float distancia,
+                               std::vector<size_t>& linhas) const {
+    linhas.clear();
+    if (distancia <= 0) return;
+
+    // Arco que contém o círculo de busca; fora dele ninguém está a menos de `distancia`
+    float meiaAbertura = (raio > distancia) ? std::asin(distancia / raio) : PI_F;
+    const float x = raio * std::cos(angulo);
+    const float y = raio * std::sin(angulo);
+    const float distancia2 = distancia * distancia;
+
+    indice.visitarArco(angulo, meiaAbertura, [&](uint32_t slot) {
+        size_t i = organismos.getLinha(HandleOrganismo{slot});
+        float r = organismos.raioOrbital[i];
+        float dx = r * std::cos(organismos.anguloOrbital[i]) - x;
+        float dy = r * std::sin(organismos.anguloOrbital[i]) - y;
+        if (dx * dx + dy * dy <= distancia2) {
+            linhas.push_back(i);
         }
-    }
-    return count > 0 ? total / count : 0;
+    });
+}
+
+void Populacao::buscarNoArco(float anguloInicio, float anguloFim, float raioMin, float raioMax,
+                             std::vector<size_t>& linhas) const {
+    linhas.clear();
+    float abertura = std::fmod(anguloFim - anguloInicio, 2 * PI_F);
+    if (abertura < 0) abertura += 2 * PI_F;
+    const float meiaAbertura = abertura * 0.5f;
+    const float centro = anguloInicio + meiaAbertura;
+
+    indice.visitarArco(centro, meiaAbertura, [&](uint32_t slot) {
+        size_t i = organismos.getLinha(HandleOrganismo{slot});
+        float r = organismos.raioOrbital[i];
+        if (r < raioMin || r > raioMax) return;
+        float desvio = std::fmod(organismos.anguloOrbital[i] - anguloInicio, 2 * PI_F);
+        if (desvio < 0) desvio += 2 * PI_F;
+        if (desvio <= abertura) {
+            linhas.push_back(i);
+        }
+    });
 }
 
 void Populacao::inicializarPopulacao(ZonaPlaneta zona, int quantidade) {
     for (int i = 0; i < quantidade; i++) {
         TipoOrganismo tipo = getOrganismoAleatorio(zona);
-        float angulo = (rand() % 360) * PI / 180.0f;
+        float angulo = gerador.inteiro(360) * GRAUS_PARA_RAD;
         
         float raio = 0;
         switch(zona) {
             case ZonaPlaneta::NUCLEO:
-                raio = 50 + (rand() % 50);
+                raio = 50 + gerador.inteiro(50);
                 break;
             case ZonaPlaneta::HABITAVEL:
-                raio = 150 + (rand() % 100);
+                raio = 150 + gerador.inteiro(100);
                 break;
             case ZonaPlaneta::PERIFERIA:
-                raio = 300 + (rand() % 100);  // IMPORTANTE: DEVE TER ISTO
+                raio = 300 + gerador.inteiro(100);  // IMPORTANTE: DEVE TER ISTO
                 break;
         }
         
@@ -198,23 +432,22 @@ void Populacao::inicializarPopulacao(ZonaPlaneta zona, int quantidade) {
 }
 
 void Populacao::limpar() {
-    organismos.clear();
-    novaGeracao.clear();
+    organismos.limpar();
+    indice.limpar();
+    roda.limpar();
+    aptosReproducao.clear();
+    nascimentosPendentes.clear();
+    tempoSimulado = 0;
+    estatisticas.limpar();
     totalNascimentos = 0;
     totalMortes = 0;
     geracao = 0;
 }
 
-void Populacao::desenhar(Vector2 centroTela) const {
-    for (const auto& org : organismos) {
-        org->desenhar(centroTela);
-    }
-}
-
-TipoOrganismo Populacao::getOrganismoAleatorio(ZonaPlaneta zona) const {
+TipoOrganismo Populacao::getOrganismoAleatorio(ZonaPlaneta zona) {
     switch(zona) {
         case ZonaPlaneta::NUCLEO: {
-            int r = rand() % 4;
+            int r = gerador.inteiro(4);
             switch(r) {
                 case 0: return TipoOrganismo::PYROSYNTH;
                 case 1: return TipoOrganismo::RUBRAFLORA;
@@ -223,7 +456,7 @@ TipoOrganismo Populacao::getOrganismoAleatorio(ZonaPlaneta zona) const {
             }
         }
         case ZonaPlaneta::HABITAVEL: {
-            int r = rand() % 4;
+            int r = gerador.inteiro(4);
             switch(r) {
                 case 0: return TipoOrganismo::LUMIVINE;
                 case 1: return TipoOrganismo::AEROFLORA;
@@ -232,7 +465,7 @@ TipoOrganismo Populacao::getOrganismoAleatorio(ZonaPlaneta zona) const {
             }
         }
         case ZonaPlaneta::PERIFERIA: {
-            int r = rand() % 4;
+            int r = gerador.inteiro(4);
             switch(r) {
                 case 0: return TipoOrganismo::CRYOMOSS;
                 case 1: return TipoOrganismo::GELIBLOOM;
@@ -245,12 +478,61 @@ TipoOrganismo Populacao::getOrganismoAleatorio(ZonaPlaneta zona) const {
 }
 void Populacao::removerAleatorios(int quantidade) {
     int removidos = 0;
-    for (auto& org : organismos) {
+    const size_t n = organismos.quantidade();
+    for (size_t i = 0; i < n; i++) {
         if (removidos >= quantidade) break;
-        if (org->isVivo()) {
-            org->setVivo(false);
+        if (organismos.vivo[i]) {
+            morrer(i);
             removidos++;
         }
     }
     removerMortos();
 }
+
+// Valores soltos de uma Populacao no snapshot
+struct EstadoPopulacao {
+    double tempoSimulado;
+    uint64_t contadorGerador;
+    int32_t totalNascimentos;
+    int32_t totalMortes;
+    int32_t geracao;
+    int32_t populacaoMaxima;
+};
+
+void Populacao::salvarEstado(GravadorSnapshot& s, const std::string& p) const {
+    EstadoPopulacao estado{};
+    estado.tempoSimulado = tempoSimulado;
+    estado.contadorGerador = gerador.getContador();
+    estado.totalNascimentos = totalNascimentos;
+    estado.totalMortes = totalMortes;
+    estado.geracao = geracao;
+    estado.populacaoMaxima = populacaoMaxima;
+    s.adicionarValor(p + "estado", estado);
+    s.adicionarValor(p + "estatisticas", estatisticas);
+    s.adicionarColuna(p + "aptosReproducao", aptosReproducao);
+    organismos.salvarEstado(s, p + "pool.");
+    roda.salvarEstado(s, p + "roda.");
+}
+
+bool Populacao::carregarEstado(const LeitorSnapshot& s, const std::string& p, ZonaPlaneta zona) {
+    limpar();
+    EstadoPopulacao estado;
+    if (!s.lerValor(p + "estado", estado) || !s.lerValor(p + "estatisticas", estatisticas) ||
+        !s.lerColuna(p + "aptosReproducao", aptosReproducao) ||
+        !organismos.carregarEstado(s, p + "pool.", zona) || !roda.carregarEstado(s, p + "roda.")) {
+        limpar();
+        return false;
+    }
+    tempoSimulado = estado.tempoSimulado;
+    gerador.setContador(estado.contadorGerador);
+    totalNascimentos = estado.totalNascimentos;
+    totalMortes = estado.totalMortes;
+    geracao = estado.geracao;
+    setPopulacaoMaxima(estado.populacaoMaxima);
+
+    // O índice angular é derivado das posições
+    for (size_t i = 0; i < organismos.quantidade(); i++) {
+        indice.inserir(organismos.getHandle(i).slot, organismos.anguloOrbital[i]);
+    }
+    return true;
+}
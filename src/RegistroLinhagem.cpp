@@ -0,0 +1,200 @@
+#include "../include/RegistroLinhagem.hpp"
+#include "../include/Especies.hpp"
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+
+// Formato do arquivo (ordem de bytes da máquina que gravou):
+//   cabeçalho: "OBLN" + uint32 versão
+//   blocos:    uint32 n, seguido das colunas inteiras na ordem da classe
+static const char ASSINATURA[4] = {'O', 'B', 'L', 'N'};
+static constexpr uint32_t VERSAO_ARQUIVO = 1;
+static constexpr uint32_t LINHA_INVALIDA = 0xFFFFFFFFu;
+
+static int16_t quantizar(float delta, float escala) {
+    float passos = std::round(delta / escala);
+    passos = std::max(-32768.0f, std::min(32767.0f, passos));
+    return static_cast<int16_t>(passos);
+}
+
+template <typename T>
+static void gravarColuna(std::ofstream& arquivo, const std::vector<T>& coluna) {
+    arquivo.write(reinterpret_cast<const char*>(coluna.data()),
+                  static_cast<std::streamsize>(coluna.size() * sizeof(T)));
+}
+
+template <typename T>
+static bool lerColuna(std::ifstream& arquivo, std::vector<T>& coluna, size_t inicio, size_t n) {
+    coluna.resize(inicio + n);
+    arquivo.read(reinterpret_cast<char*>(coluna.data() + inicio), static_cast<std::streamsize>(n * sizeof(T)));
+    return static_cast<bool>(arquivo);
+}
+
+RegistroLinhagem::RegistroLinhagem() : totalRegistrado(0) {}
+
+RegistroLinhagem::~RegistroLinhagem() {
+    fecharArquivo();
+}
+
+Nascimento RegistroLinhagem::descreverNascimento(const Organismo& org, IdOrganismo idOrganismo, IdOrganismo idPai) {
+    const DescritorEspecie& especie = getEspecie(org.getTipo());
+    Nascimento n;
+    n.id = idOrganismo;
+    n.idPai = idPai;
+    n.tipo = org.getTipo();
+    n.deltaEficiencia = quantizar(org.getEficienciaMetabolica() - especie.eficienciaMetabolica, ESCALA_DELTA_ATRIBUTO);
+    n.deltaResistencia = quantizar(org.getResistenciaTermica() - especie.resistenciaTermica, ESCALA_DELTA_ATRIBUTO);
+    n.deltaVelocidade = quantizar(org.getVelocidadeOrbital() - especie.velocidadeOrbital, ESCALA_DELTA_ATRIBUTO);
+    n.deltaEnergiaMaxima = quantizar(org.getEnergiaMaxima() - especie.energiaMaxima, ESCALA_DELTA_ENERGIA);
+    return n;
+}
+
+void RegistroLinhagem::registrar(const Nascimento& n, uint32_t tick) {
+    id.push_back(n.id);
+    idPai.push_back(n.idPai);
+    tickNascimento.push_back(tick);
+    tipo.push_back(static_cast<uint8_t>(n.tipo));
+    deltaEficiencia.push_back(n.deltaEficiencia);
+    deltaResistencia.push_back(n.deltaResistencia);
+    deltaVelocidade.push_back(n.deltaVelocidade);
+    deltaEnergiaMaxima.push_back(n.deltaEnergiaMaxima);
+    totalRegistrado++;
+
+    if (arquivo.is_open()) {
+        if (quantidade() >= TAMANHO_BLOCO) gravarBloco();
+    } else {
+        indexar(quantidade() - 1);
+    }
+}
+
+void RegistroLinhagem::indexar(size_t linha) {
+    IdOrganismo idOrganismo = id[linha];
+    int z = static_cast<int>(getZonaDoId(idOrganismo));
+    if (z < 0 || z >= NUM_ZONAS) return;
+    uint64_t sequencial = getSequencialDoId(idOrganismo);
+    std::vector<uint32_t>& linhas = linhaDoSequencial[z];
+    if (sequencial >= linhas.size()) linhas.resize(sequencial + 1, LINHA_INVALIDA);
+    linhas[sequencial] = static_cast<uint32_t>(linha);
+}
+
+void RegistroLinhagem::limpar() {
+    id.clear();
+    idPai.clear();
+    tickNascimento.clear();
+    tipo.clear();
+    deltaEficiencia.clear();
+    deltaResistencia.clear();
+    deltaVelocidade.clear();
+    deltaEnergiaMaxima.clear();
+    for (auto& linhas : linhaDoSequencial) linhas.clear();
+    totalRegistrado = 0;
+}
+
+bool RegistroLinhagem::abrirArquivo(const std::string& caminho) {
+    fecharArquivo();
+    arquivo.open(caminho, std::ios::binary | std::ios::trunc);
+    if (!arquivo.is_open()) return false;
+    arquivo.write(ASSINATURA, sizeof(ASSINATURA));
+    arquivo.write(reinterpret_cast<const char*>(&VERSAO_ARQUIVO), sizeof(VERSAO_ARQUIVO));
+
+    // O que já estava em memória entra no primeiro bloco
+    for (auto& linhas : linhaDoSequencial) linhas.clear();
+    if (quantidade() >= TAMANHO_BLOCO) gravarBloco();
+    return static_cast<bool>(arquivo);
+}
+
+bool RegistroLinhagem::gravarBloco() {
+    uint32_t n = static_cast<uint32_t>(quantidade());
+    if (n > 0) {
+        arquivo.write(reinterpret_cast<const char*>(&n), sizeof(n));
+        gravarColuna(arquivo, id);
+        gravarColuna(arquivo, idPai);
+        gravarColuna(arquivo, tickNascimento);
+        gravarColuna(arquivo, tipo);
+        gravarColuna(arquivo, deltaEficiencia);
+        gravarColuna(arquivo, deltaResistencia);
+        gravarColuna(arquivo, deltaVelocidade);
+        gravarColuna(arquivo, deltaEnergiaMaxima);
+    }
+
+    // As colunas mantêm a capacidade para o próximo bloco
+    uint64_t total = totalRegistrado;
+    limpar();
+    totalRegistrado = total;
+    return static_cast<bool>(arquivo);
+}
+
+void RegistroLinhagem::fecharArquivo() {
+    if (!arquivo.is_open()) return;
+    gravarBloco();
+    arquivo.close();
+}
+
+bool RegistroLinhagem::carregar(const std::string& caminho) {
+    std::ifstream entrada(caminho, std::ios::binary);
+    if (!entrada.is_open()) return false;
+
+    char assinatura[4];
+    uint32_t versao = 0;
+    entrada.read(assinatura, sizeof(assinatura));
+    entrada.read(reinterpret_cast<char*>(&versao), sizeof(versao));
+    if (!entrada || std::memcmp(assinatura, ASSINATURA, sizeof(ASSINATURA)) != 0 || versao != VERSAO_ARQUIVO) {
+        return false;
+    }
+
+    const std::streamoff inicioBlocos = entrada.tellg();
+    entrada.seekg(0, std::ios::end);
+    std::streamoff restante = entrada.tellg() - inicioBlocos;
+    entrada.seekg(inicioBlocos);
+    const size_t bytesPorLinha = sizeof(id[0]) + sizeof(idPai[0]) + sizeof(tickNascimento[0]) + sizeof(tipo[0]) +
+                                 sizeof(deltaEficiencia[0]) + sizeof(deltaResistencia[0]) +
+                                 sizeof(deltaVelocidade[0]) + sizeof(deltaEnergiaMaxima[0]);
+
+    fecharArquivo();
+    limpar();
+    uint32_t n = 0;
+    while (entrada.read(reinterpret_cast<char*>(&n), sizeof(n))) {
+        restante -= sizeof(n);
+        // Bloco cortado (execução interrompida): fica com os anteriores. O
+        // tamanho é conferido antes de as colunas crescerem.
+        const uint64_t tamanhoBloco = static_cast<uint64_t>(n) * bytesPorLinha;
+        if (tamanhoBloco > static_cast<uint64_t>(restante)) break;
+        restante -= static_cast<std::streamoff>(tamanhoBloco);
+
+        size_t inicio = quantidade();
+        bool ok = lerColuna(entrada, id, inicio, n) &&
+                  lerColuna(entrada, idPai, inicio, n) &&
+                  lerColuna(entrada, tickNascimento, inicio, n) &&
+                  lerColuna(entrada, tipo, inicio, n) &&
+                  lerColuna(entrada, deltaEficiencia, inicio, n) &&
+                  lerColuna(entrada, deltaResistencia, inicio, n) &&
+                  lerColuna(entrada, deltaVelocidade, inicio, n) &&
+                  lerColuna(entrada, deltaEnergiaMaxima, inicio, n);
+        if (!ok) {
+            limpar();
+            return false;
+        }
+    }
+
+    for (size_t i = 0; i < quantidade(); i++) indexar(i);
+    totalRegistrado = quantidade();
+    return true;
+}
+
+size_t RegistroLinhagem::buscar(IdOrganismo idOrganismo) const {
+    int z = static_cast<int>(getZonaDoId(idOrganismo));
+    if (idOrganismo == ID_INVALIDO || z < 0 || z >= NUM_ZONAS) return NAO_ENCONTRADO;
+    uint64_t sequencial = getSequencialDoId(idOrganismo);
+    const std::vector<uint32_t>& linhas = linhaDoSequencial[z];
+    if (sequencial >= linhas.size() || linhas[sequencial] == LINHA_INVALIDA) return NAO_ENCONTRADO;
+    return linhas[sequencial];
+}
+
+void RegistroLinhagem::getAncestrais(IdOrganismo idOrganismo, std::vector<IdOrganismo>& ancestrais) const {
+    ancestrais.clear();
+    size_t linha = buscar(idOrganismo);
+    while (linha != NAO_ENCONTRADO && idPai[linha] != ID_INVALIDO) {
+        ancestrais.push_back(idPai[linha]);
+        linha = buscar(idPai[linha]);
+    }
+}
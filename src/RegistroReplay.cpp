@@ -0,0 +1,154 @@
+#include "../include/RegistroReplay.hpp"
+#include <cstring>
+
+static const char ASSINATURA[4] = {'O', 'B', 'R', 'P'};
+static constexpr uint32_t VERSAO_ARQUIVO = 2;
+
+template <typename T>
+static void gravar(std::ofstream& arquivo, const T& valor) {
+    arquivo.write(reinterpret_cast<const char*>(&valor), sizeof(T));
+}
+
+template <typename T>
+static bool ler(std::ifstream& arquivo, T& valor) {
+    arquivo.read(reinterpret_cast<char*>(&valor), sizeof(T));
+    return static_cast<bool>(arquivo);
+}
+
+// Deltas de tick em 7 bits por byte: quase sempre um ou dois bytes
+static bool lerVarint(std::ifstream& arquivo, uint64_t& valor) {
+    valor = 0;
+    for (int deslocamento = 0; deslocamento < 64; deslocamento += 7) {
+        uint8_t byte;
+        if (!ler(arquivo, byte)) return false;
+        valor |= static_cast<uint64_t>(byte & 0x7F) << deslocamento;
+        if (!(byte & 0x80)) return true;
+    }
+    return false;
+}
+
+RegistroReplay::RegistroReplay()
+    : semente(0), taxaTick(0), encerrado(false), tickFinal(0), checksumFinal(0), ultimoTickGravado(0) {}
+
+RegistroReplay::~RegistroReplay() {
+    arquivo.close();
+}
+
+bool RegistroReplay::abrir(const std::string& caminho, uint64_t s, float taxa,
+                           const FrequenciasSubsistemas& f, const ParametrosSimulacao& p) {
+    arquivo.close();
+    semente = s;
+    taxaTick = taxa;
+    frequencias = f;
+    parametros = p;
+    comandos.clear();
+    encerrado = false;
+    ultimoTickGravado = 0;
+
+    arquivo.open(caminho, std::ios::binary | std::ios::trunc);
+    if (!arquivo.is_open()) return false;
+    arquivo.write(ASSINATURA, sizeof(ASSINATURA));
+    gravar(arquivo, VERSAO_ARQUIVO);
+    gravar(arquivo, semente);
+    gravar(arquivo, taxaTick);
+    gravar(arquivo, frequencias.ambiente);
+    gravar(arquivo, frequencias.biologia);
+    gravar(arquivo, frequencias.missoes);
+
+    std::vector<std::string> nomes = ParametrosSimulacao::getNomes();
+    gravar(arquivo, static_cast<uint32_t>(nomes.size()));
+    for (const std::string& nome : nomes) gravar(arquivo, *parametros.localizar(nome));
+    arquivo.flush();
+    return static_cast<bool>(arquivo);
+}
+
+void RegistroReplay::gravarTick(uint64_t tick) {
+    uint64_t delta = tick - ultimoTickGravado;
+    ultimoTickGravado = tick;
+    do {
+        uint8_t byte = delta & 0x7F;
+        delta >>= 7;
+        if (delta) byte |= 0x80;
+        gravar(arquivo, byte);
+    } while (delta);
+}
+
+void RegistroReplay::registrar(const ComandoReplay& c) {
+    comandos.push_back(c);
+    if (!arquivo.is_open()) return;
+    gravarTick(c.tick);
+    gravar(arquivo, static_cast<uint8_t>(c.tipo));
+    gravar(arquivo, c.zona);
+    gravar(arquivo, c.codigo);
+    gravar(arquivo, c.valor);
+    arquivo.flush();
+}
+
+void RegistroReplay::encerrar(uint64_t tick, uint64_t checksum) {
+    encerrado = true;
+    tickFinal = tick;
+    checksumFinal = checksum;
+    if (!arquivo.is_open()) return;
+    gravarTick(tick);
+    gravar(arquivo, static_cast<uint8_t>(TipoComando::FIM));
+    gravar(arquivo, checksum);
+    arquivo.close();
+}
+
+bool RegistroReplay::carregar(const std::string& caminho, std::string& erro) {
+    std::ifstream entrada(caminho, std::ios::binary);
+    if (!entrada.is_open()) {
+        erro = "nao foi possivel abrir " + caminho;
+        return false;
+    }
+
+    char assinatura[4];
+    uint32_t versao = 0;
+    entrada.read(assinatura, sizeof(assinatura));
+    if (!entrada || std::memcmp(assinatura, ASSINATURA, sizeof(ASSINATURA)) != 0 ||
+        !ler(entrada, versao) || versao != VERSAO_ARQUIVO) {
+        erro = caminho + " nao e um replay (versao " + std::to_string(VERSAO_ARQUIVO) + ")";
+        return false;
+    }
+
+    uint32_t numParametros = 0;
+    bool ok = ler(entrada, semente) && ler(entrada, taxaTick) &&
+              ler(entrada, frequencias.ambiente) && ler(entrada, frequencias.biologia) &&
+              ler(entrada, frequencias.missoes) && ler(entrada, numParametros);
+    std::vector<std::string> nomes = ParametrosSimulacao::getNomes();
+    if (!ok || numParametros != nomes.size()) {
+        erro = caminho + ": cabecalho invalido";
+        return false;
+    }
+    parametros = ParametrosSimulacao();
+    for (const std::string& nome : nomes) {
+        if (!ler(entrada, *parametros.localizar(nome))) {
+            erro = caminho + ": cabecalho invalido";
+            return false;
+        }
+    }
+
+    comandos.clear();
+    encerrado = false;
+    uint64_t tick = 0, delta = 0;
+    while (lerVarint(entrada, delta)) {
+        tick += delta;
+        uint8_t tipo;
+        if (!ler(entrada, tipo)) break;
+        if (static_cast<TipoComando>(tipo) == TipoComando::FIM) {
+            encerrado = ler(entrada, checksumFinal);
+            tickFinal = tick;
+            break;
+        }
+        ComandoReplay c;
+        c.tick = tick;
+        c.tipo = static_cast<TipoComando>(tipo);
+        if (tipo > static_cast<uint8_t>(TipoComando::FIM) ||
+            !ler(entrada, c.zona) || !ler(entrada, c.codigo) || !ler(entrada, c.valor)) {
+            break;   // fim truncado: o que veio antes continua valendo
+        }
+        comandos.push_back(c);
+    }
+    if (!encerrado) tickFinal = comandos.empty() ? 0 : comandos.back().tick;
+    return true;
+}
@@ -0,0 +1,123 @@
+#include "../include/RenderizadorOrganismos.hpp"
+#include "../include/GerenciadorTexturas.hpp"
+#include "../include/Especies.hpp"
+#include <cmath>
+
+// Margem além da borda da tela (o maior organismo texturizado tem ~48 px)
+static const float MARGEM_VISIVEL = 32.0f;
+
+void RenderizadorOrganismos::desenharPopulacao(const Populacao& populacao, Vector2 centroTela, float alpha) {
+    const OrganismoPool& organismos = populacao.getOrganismos();
+    const size_t n = organismos.quantidade();
+    const float larguraTela = (float)GetScreenWidth();
+    const float alturaTela = (float)GetScreenHeight();
+    for (size_t i = 0; i < n; i++) {
+        if (!organismos.vivo[i]) continue;
+
+        // O ângulo volta a 0 ao completar a órbita; interpola pelo caminho curto
+        float delta = organismos.anguloOrbital[i] - organismos.anguloAnterior[i];
+        if (delta < -PI_F) delta += 2 * PI_F;
+        float angulo = organismos.anguloAnterior[i] + delta * alpha;
+
+        Vector2 posicao = {
+            centroTela.x + organismos.raioOrbital[i] * std::cos(angulo),
+            centroTela.y + organismos.raioOrbital[i] * std::sin(angulo)
+        };
+
+        // A Periferia passa das bordas de cima e de baixo: fora da tela não desenha
+        if (posicao.x < -MARGEM_VISIVEL || posicao.x > larguraTela + MARGEM_VISIVEL ||
+            posicao.y < -MARGEM_VISIVEL || posicao.y > alturaTela + MARGEM_VISIVEL) continue;
+
+        TipoOrganismo tipo = organismos.tipo[i];
+        float energia = organismos.energia[i];
+        float energiaMaxima = organismos.energiaMaxima[i];
+        Color cor = getCorPorTipo(tipo);
+        float opacidade = calcularOpacidade(energia, energiaMaxima);
+        if (opacidade < 1.0f) {
+            cor = ColorAlpha(cor, opacidade);
+        }
+        desenharOrganismo(tipo, posicao, calcularTamanho(energia, energiaMaxima), cor);
+    }
+}
+
+void RenderizadorOrganismos::desenharOrganismo(TipoOrganismo tipo, Vector2 posicao, float tamanho, Color cor) {
+    float x = posicao.x;
+    float y = posicao.y;
+
+    const Texture2D* textura = GerenciadorTexturas::instancia().obter(tipo);
+    if (textura != nullptr) {
+        Rectangle src = { 0, 0, (float)textura->width, (float)textura->height };
+        Rectangle dst = { x, y, tamanho * 6, tamanho * 6 };
+        Vector2 origin = { dst.width / 2, dst.height / 2 };
+
+        DrawTexturePro(*textura, src, dst, origin, 0.0f, WHITE);
+    } else {
+        DrawCircle((int)x, (int)y, tamanho, cor);
+    }
+
+    // 🔽 efeitos ESPECÍFICOS continuam AQUI DENTRO
+    switch (tipo) {
+        case TipoOrganismo::PYROSYNTH:
+            DrawCircle((int)x, (int)y, tamanho * 1.3f, Fade(ORANGE, 0.2f));
+            break;
+
+        case TipoOrganismo::IGNIVAR:
+            if ((int)(GetTime() * 10) % 2 == 0) {
+                DrawCircleLines((int)x, (int)y, tamanho + 3, YELLOW);
+            }
+            break;
+
+        case TipoOrganismo::LUMIVINE:
+            DrawCircle((int)x, (int)y, tamanho * 1.5f, Fade(LIME, 0.15f));
+            break;
+
+        case TipoOrganismo::SYNAPSEX: {
+            float pulse = std::sin(GetTime() * 3) * 0.5f + 0.5f;
+            DrawCircleLines(
+                (int)x,
+                (int)y,
+                tamanho + 2 + pulse * 3,
+                Fade(GREEN, 0.3f + pulse * 0.3f)
+            );
+            break;
+        }
+
+        case TipoOrganismo::CRYOMOSS:
+            DrawRectangleLines(
+                (int)(x - tamanho/2 - 2),
+                (int)(y - tamanho/2 - 2),
+                (int)(tamanho + 4),
+                (int)(tamanho + 4),
+                Fade(SKYBLUE, 0.4f)
+            );
+            break;
+
+        default:
+            break;
+    }
+}
+
+Color RenderizadorOrganismos::getCorPorTipo(TipoOrganismo tipo) {
+    const uint8_t* c = getEspecie(tipo).cor;
+    return Color{c[0], c[1], c[2], c[3]};
+}
+
+float RenderizadorOrganismos::calcularTamanho(float energia, float energiaMaxima) {
+    // Tamanho baseado na energia
+    return 3.0f + (energia / energiaMaxima) * 5.0f;
+}
+
+float RenderizadorOrganismos::calcularOpacidade(float energia, float energiaMaxima) {
+    // Organismos debilitados ficam translúcidos
+    float saude = energia / energiaMaxima;
+    return (saude < 0.5f) ? 0.5f + saude : 1.0f;
+}
+
+Color RenderizadorOrganismos::getCorZona(ZonaPlaneta zona) {
+    switch(zona) {
+        case ZonaPlaneta::NUCLEO: return RED;
+        case ZonaPlaneta::HABITAVEL: return GREEN;
+        case ZonaPlaneta::PERIFERIA: return BLUE;
+        default: return WHITE;
+    }
+}
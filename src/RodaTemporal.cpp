@@ -0,0 +1,107 @@
+#include "../include/RodaTemporal.hpp"
+
+RodaTemporal::RodaTemporal() : agora(0), pendentes(0) {}
+
+void RodaTemporal::agendar(uint64_t prazo, uint32_t alvo, uint32_t geracao, uint8_t tipo) {
+    if (prazo <= agora) prazo = agora + 1;
+    inserir(Temporizador{prazo, alvo, geracao, tipo});
+    pendentes++;
+}
+
+void RodaTemporal::inserir(const Temporizador& t) {
+    uint64_t distancia = t.prazo - agora;
+    if (distancia < TAMANHO_NIVEL0) {
+        nivel0[t.prazo & (TAMANHO_NIVEL0 - 1)].push_back(t);
+        return;
+    }
+
+    int deslocamento = BITS_NIVEL0;
+    for (int n = 0; n < NUM_NIVEIS - 1; n++) {
+        if (distancia < (1ull << (deslocamento + BITS_NIVEL))) {
+            niveis[n][(t.prazo >> deslocamento) & (TAMANHO_NIVEL - 1)].push_back(t);
+            return;
+        }
+        deslocamento += BITS_NIVEL;
+    }
+    espera.push_back(t);
+}
+
+void RodaTemporal::descer(std::vector<Temporizador>& posicao) {
+    // Os prazos agora estão mais perto: reinserir os coloca num nível mais fino
+    std::vector<Temporizador> movidos;
+    movidos.swap(posicao);
+    for (const Temporizador& t : movidos) {
+        inserir(t);
+    }
+    // Devolve a capacidade para a posição esvaziada (a lista de espera pode
+    // ter recebido de volta quem ainda está longe)
+    movidos.clear();
+    if (posicao.empty() && posicao.capacity() < movidos.capacity()) posicao.swap(movidos);
+}
+
+void RodaTemporal::limpar() {
+    for (auto& posicao : nivel0) posicao.clear();
+    for (auto& nivel : niveis) {
+        for (auto& posicao : nivel) posicao.clear();
+    }
+    espera.clear();
+    vencendo.clear();
+    agora = 0;
+    pendentes = 0;
+}
+
+void RodaTemporal::salvarEstado(GravadorSnapshot& s, const std::string& p) const {
+    std::vector<uint32_t> contagens;
+    std::vector<Temporizador> temporizadores;
+    temporizadores.reserve(pendentes);
+    auto juntar = [&](const std::vector<Temporizador>& posicao) {
+        contagens.push_back(static_cast<uint32_t>(posicao.size()));
+        temporizadores.insert(temporizadores.end(), posicao.begin(), posicao.end());
+    };
+    for (const auto& posicao : nivel0) juntar(posicao);
+    for (const auto& nivel : niveis) {
+        for (const auto& posicao : nivel) juntar(posicao);
+    }
+    juntar(espera);
+
+    s.adicionarValor(p + "agora", agora);
+    s.adicionarCopia(p + "contagens", contagens.data(), contagens.size() * sizeof(uint32_t));
+    s.adicionarCopia(p + "temporizadores", temporizadores.data(), temporizadores.size() * sizeof(Temporizador));
+}
+
+bool RodaTemporal::carregarEstado(const LeitorSnapshot& s, const std::string& p) {
+    std::vector<uint32_t> contagens;
+    std::vector<Temporizador> temporizadores;
+    limpar();
+    const size_t numPosicoes = TAMANHO_NIVEL0 + (NUM_NIVEIS - 1) * TAMANHO_NIVEL + 1;
+    if (!s.lerValor(p + "agora", agora) || !s.lerColuna(p + "contagens", contagens) ||
+        !s.lerColuna(p + "temporizadores", temporizadores) || contagens.size() != numPosicoes) {
+        limpar();
+        return false;
+    }
+
+    size_t proximo = 0;
+    size_t c = 0;
+    bool ok = true;
+    auto distribuir = [&](std::vector<Temporizador>& posicao) {
+        size_t n = contagens[c++];
+        if (!ok || n > temporizadores.size() - proximo) {
+            ok = false;
+            return;
+        }
+        posicao.assign(temporizadores.begin() + proximo, temporizadores.begin() + proximo + n);
+        proximo += n;
+    };
+    for (auto& posicao : nivel0) distribuir(posicao);
+    for (auto& nivel : niveis) {
+        for (auto& posicao : nivel) distribuir(posicao);
+    }
+    distribuir(espera);
+
+    if (!ok || proximo != temporizadores.size()) {
+        limpar();
+        return false;
+    }
+    pendentes = temporizadores.size();
+    return true;
+}
@@ -0,0 +1,77 @@
+#include "../include/RoteiroEventos.hpp"
+#include "../include/Simulacao.hpp"
+#include <algorithm>
+#include <fstream>
+#include <sstream>
+
+bool RoteiroEventos::lerZona(const std::string& nome, ZonaPlaneta& zona) {
+    static const char* NOMES[NUM_ZONAS] = { "NUCLEO", "HABITAVEL", "PERIFERIA" };
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        if (nome == NOMES[z]) {
+            zona = static_cast<ZonaPlaneta>(z);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool RoteiroEventos::lerEvento(const std::string& nome, TipoEvento& evento) {
+    static const struct { const char* nome; TipoEvento evento; } EVENTOS[] = {
+        { "SOBRECARGA_TERMICA", TipoEvento::SOBRECARGA_TERMICA },
+        { "ESCASSEZ_ENERGIA", TipoEvento::ESCASSEZ_ENERGIA },
+        { "ESTABILIDADE_TEMPORARIA", TipoEvento::ESTABILIDADE_TEMPORARIA },
+        { "RADIACAO_INTENSA", TipoEvento::RADIACAO_INTENSA },
+        { "ABUNDANCIA_RECURSOS", TipoEvento::ABUNDANCIA_RECURSOS },
+        { "TEMPERATURA_EXTREMA", TipoEvento::TEMPERATURA_EXTREMA },
+    };
+    for (const auto& e : EVENTOS) {
+        if (nome == e.nome) {
+            evento = e.evento;
+            return true;
+        }
+    }
+    return false;
+}
+
+bool RoteiroEventos::carregar(const std::string& caminho, std::string& erro) {
+    std::ifstream arquivo(caminho);
+    if (!arquivo.is_open()) {
+        erro = "nao foi possivel abrir " + caminho;
+        return false;
+    }
+
+    entradas.clear();
+    proxima = 0;
+    std::string linha;
+    int numero = 0;
+    while (std::getline(arquivo, linha)) {
+        numero++;
+        size_t inicio = linha.find_first_not_of(" \t\r");
+        if (inicio == std::string::npos || linha[inicio] == '#') continue;
+
+        std::istringstream campos(linha);
+        Entrada e;
+        std::string zona, evento;
+        if (!(campos >> e.tempo >> zona >> evento >> e.duracao) ||
+            !lerZona(zona, e.zona) || !lerEvento(evento, e.evento) || e.tempo < 0 || e.duracao <= 0) {
+            erro = caminho + ":" + std::to_string(numero) + ": " + linha;
+            return false;
+        }
+        adicionar(e);
+    }
+    return true;
+}
+
+void RoteiroEventos::adicionar(const Entrada& e) {
+    // Mantém a ordem por tempo; empates ficam na ordem do arquivo
+    auto pos = std::upper_bound(entradas.begin(), entradas.end(), e.tempo,
+                                [](float t, const Entrada& x) { return t < x.tempo; });
+    entradas.insert(pos, e);
+}
+
+void RoteiroEventos::aplicar(Simulacao& sim) {
+    while (proxima < entradas.size() && entradas[proxima].tempo <= sim.getTempoSimulacao()) {
+        const Entrada& e = entradas[proxima++];
+        sim.ativarEvento(e.zona, e.evento, e.duracao);
+    }
+}
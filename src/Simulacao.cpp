@@ -0,0 +1,574 @@
+#include "../include/Simulacao.hpp"
+#include "../include/Perfilador.hpp"
+#include <algorithm>
+#include <cmath>
+#include <thread>
+
+// Período em ticks de um subsistema a `frequencia` Hz sob a taxa de tick dada
+static int periodoEmTicks(float taxaTick, float frequencia) {
+    if (frequencia <= 0 || frequencia >= taxaTick) return 1;
+    return std::max(1, static_cast<int>(std::lround(taxaTick / frequencia)));
+}
+
+// Algum múltiplo de `periodo` em [primeiro, ultimo]?
+static bool venceEntre(uint64_t primeiro, uint64_t ultimo, int periodo) {
+    return ultimo / periodo > (primeiro - 1) / periodo;
+}
+
+Simulacao::Simulacao()
+    : threadsTrabalho(0), periodoTelemetria(1), ultimoTickTelemetria(0),
+      fase(1),
+      semente(0), passoFixo(1.0f / TAXA_TICK_PADRAO), tickAtual(0),
+      ticksPorSegundo(TAXA_TICK_PADRAO), tempoBase(0), tickBase(0),
+      ultimoTickMissoes(0),
+      vidaSupercomputador(100), vidaMaximaSupercomputador(100) {
+    recalcularPeriodos();
+    // Uma zona fica com a thread chamadora; as outras duas com auxiliares
+    int nucleos = static_cast<int>(std::thread::hardware_concurrency());
+    setThreadsTrabalho(std::min(NUM_ZONAS - 1, nucleos - 1));
+}
+
+Simulacao::~Simulacao() {
+    encerrarReplay();
+    encerrarTelemetria();
+}
+
+void Simulacao::inicializar(uint64_t s) {
+    encerrarReplay();
+    encerrarTelemetria();
+    semente = s;
+    fase = 1;
+    tickAtual = 0;
+    tempoBase = 0;
+    tickBase = 0;
+    ultimoTickMissoes = 0;
+    vidaSupercomputador = vidaMaximaSupercomputador;
+
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        ultimoTickAmbiente[z] = 0;
+        ultimoTickBiologia[z] = 0;
+        ambientes[z] = std::make_unique<Ambiente>(static_cast<ZonaPlaneta>(z), parametros.zonas[z]);
+        populacoes[z] = std::make_unique<Populacao>();
+        populacoes[z]->setParametros(parametros.reproducao, parametros.mutacao);
+        populacoes[z]->setPopulacaoMaxima(static_cast<int>(std::lround(parametros.populacaoMaximaZona)));
+        populacoes[z]->setGerador(GeradorAleatorio(semente, static_cast<uint64_t>(z)));
+        populacoes[z]->setAnotarNascimentos(linhagem != nullptr);
+    }
+
+    populacoes[static_cast<int>(ZonaPlaneta::NUCLEO)]->inicializarPopulacao(ZonaPlaneta::NUCLEO, 15);
+    populacoes[static_cast<int>(ZonaPlaneta::HABITAVEL)]->inicializarPopulacao(ZonaPlaneta::HABITAVEL, 17);
+    populacoes[static_cast<int>(ZonaPlaneta::PERIFERIA)]->inicializarPopulacao(ZonaPlaneta::PERIFERIA, 15);
+
+    gestorMissoes = std::make_unique<GestorMissoes>();
+    recolherNascimentos();
+}
+
+RegistroLinhagem& Simulacao::ativarLinhagem() {
+    if (!linhagem) linhagem = std::make_unique<RegistroLinhagem>();
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        if (populacoes[z]) populacoes[z]->setAnotarNascimentos(true);
+    }
+    return *linhagem;
+}
+
+void Simulacao::recolherNascimentos() {
+    if (!linhagem) return;
+    // Sempre na ordem das zonas, para o registro não depender das threads
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        std::vector<Nascimento>& pendentes = populacoes[z]->getNascimentosPendentes();
+        for (const Nascimento& n : pendentes) {
+            linhagem->registrar(n, static_cast<uint32_t>(tickAtual));
+        }
+        pendentes.clear();
+    }
+}
+
+bool Simulacao::gravarReplay(const std::string& caminho) {
+    encerrarReplay();
+    replay = std::make_unique<RegistroReplay>();
+    if (!replay->abrir(caminho, semente, getTaxaTick(), frequencias, parametros)) {
+        replay.reset();
+        return false;
+    }
+    return true;
+}
+
+void Simulacao::encerrarReplay() {
+    if (!replay) return;
+    replay->encerrar(tickAtual, calcularChecksum());
+    replay.reset();
+}
+
+void Simulacao::registrarComando(TipoComando tipo, int zona, int codigo, float valor) {
+    if (!replay) return;
+    ComandoReplay c;
+    c.tick = tickAtual;
+    c.tipo = tipo;
+    c.zona = static_cast<uint8_t>(zona);
+    c.codigo = static_cast<uint8_t>(codigo);
+    c.valor = valor;
+    replay->registrar(c);
+}
+
+void Simulacao::aplicarComando(const ComandoReplay& c) {
+    ZonaPlaneta zona = static_cast<ZonaPlaneta>(c.zona);
+    switch (c.tipo) {
+        case TipoComando::ATIVAR_EVENTO:
+            ativarEvento(zona, static_cast<TipoEvento>(c.codigo), c.valor);
+            break;
+        case TipoComando::REDUZIR_TEMPO_EVENTO:
+            reduzirTempoEvento(zona, c.valor);
+            break;
+        case TipoComando::CANCELAR_EVENTOS:
+            cancelarEventos();
+            break;
+        case TipoComando::ACAO_MANUAL:
+            notificarAcaoManual(static_cast<TipoMissao>(c.codigo));
+            break;
+        case TipoComando::REPARAR:
+            repararSistema(c.valor);
+            break;
+        case TipoComando::TAXA_TICK:
+            setTaxaTick(c.valor);
+            break;
+        case TipoComando::PASSO_RAPIDO:
+        case TipoComando::VELOCIDADE:
+        case TipoComando::FIM:
+            break;
+    }
+}
+
+void Simulacao::anotarVelocidade(float multiplicador) {
+    registrarComando(TipoComando::VELOCIDADE, 0, 0, multiplicador);
+}
+
+bool Simulacao::gravarTelemetria(const std::string& caminho, int periodoTicks) {
+    encerrarTelemetria();
+    telemetria = std::make_unique<RegistroTelemetria>();
+    if (!telemetria->abrir(caminho)) {
+        telemetria.reset();
+        return false;
+    }
+    periodoTelemetria = std::max(1, periodoTicks);
+    publicarTelemetria();
+    return true;
+}
+
+void Simulacao::encerrarTelemetria() {
+    if (!telemetria) return;
+    telemetria->fechar();
+    telemetria.reset();
+}
+
+void Simulacao::publicarTelemetria() {
+    AmostraTelemetria a;
+    preencherAmostra(a);
+    telemetria->publicar(a);
+    ultimoTickTelemetria = tickAtual;
+}
+
+void Simulacao::preencherAmostra(AmostraTelemetria& a) const {
+    a = AmostraTelemetria{};
+    a.tick = tickAtual;
+    a.tempo = getTempoTotal();
+    a.fase = fase;
+    a.consciencia = getConscienciaMedia();
+    a.vidaSupercomputador = vidaSupercomputador;
+    a.missoesCompletadas = gestorMissoes->getTotalCompletadas();
+    a.pontuacao = gestorMissoes->getPontuacaoTotal();
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        const Ambiente& amb = *ambientes[z];
+        const EstatisticasPopulacao& e = populacoes[z]->getEstatisticas();
+        a.populacao[z] = e.vivos;
+        a.energiaMedia[z] = e.energiaMedia();
+        a.idadeMedia[z] = e.idadeMedia();
+        a.temperatura[z] = amb.getTemperatura();
+        a.recursos[z] = amb.getNivelRecursos();
+        a.evento[z] = static_cast<int32_t>(amb.getEventoAtual());
+        for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) a.populacaoTipo[t] += e.porTipo[t];
+    }
+}
+
+// FNV-1a de 64 bits
+static void misturarBytes(uint64_t& h, const void* dados, size_t n) {
+    const unsigned char* p = static_cast<const unsigned char*>(dados);
+    for (size_t i = 0; i < n; i++) {
+        h ^= p[i];
+        h *= 0x100000001B3ULL;
+    }
+}
+
+template <typename T>
+static void misturar(uint64_t& h, const T& valor) {
+    misturarBytes(h, &valor, sizeof(T));
+}
+
+template <typename T>
+static void misturarColuna(uint64_t& h, const std::vector<T>& coluna) {
+    misturarBytes(h, coluna.data(), coluna.size() * sizeof(T));
+}
+
+uint64_t Simulacao::calcularChecksum() const {
+    uint64_t h = 0xCBF29CE484222325ULL;
+    misturar(h, fase);
+    misturar(h, tickAtual);
+    misturar(h, getTempoSimulacao());
+    misturar(h, vidaSupercomputador);
+
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        if (!ambientes[z]) continue;
+        const Ambiente& a = *ambientes[z];
+        misturar(h, a.getTemperatura());
+        misturar(h, a.getNivelRecursos());
+        misturar(h, a.getConsciencia());
+        misturar(h, a.getEventoAtual());
+        misturar(h, a.getTempoRestanteEvento());
+
+        const Populacao& p = *populacoes[z];
+        misturar(h, p.getTotalNascimentos());
+        misturar(h, p.getTotalMortes());
+        misturar(h, p.getGerador().getContador());
+        const OrganismoPool& o = p.getOrganismos();
+        misturarColuna(h, o.id);
+        misturarColuna(h, o.energia);
+        misturarColuna(h, o.energiaMaxima);
+        misturarColuna(h, o.resistenciaTermica);
+        misturarColuna(h, o.eficienciaMetabolica);
+        misturarColuna(h, o.velocidadeOrbital);
+        misturarColuna(h, o.anguloOrbital);
+        misturarColuna(h, o.raioOrbital);
+        misturarColuna(h, o.idade);
+        misturarColuna(h, o.aptoReproducao);
+    }
+
+    if (gestorMissoes) {
+        misturar(h, gestorMissoes->getTotalCompletadas());
+        misturar(h, gestorMissoes->getPontuacaoTotal());
+        for (const Missao& m : gestorMissoes->getMissoes()) {
+            misturar(h, m.getEstado());
+            misturar(h, m.getProgresso());
+        }
+    }
+    return h;
+}
+
+ResultadoAtualizacao Simulacao::passo() {
+    tickAtual++;
+    return atualizar(1, false);
+}
+
+ResultadoAtualizacao Simulacao::passoRapido() {
+    registrarComando(TipoComando::PASSO_RAPIDO);
+    int ticks = std::max(1, static_cast<int>(PASSO_RAPIDO / passoFixo + 0.5f));
+    const float duracao = getDuracaoPassoRapido();
+    if (duracao < PASSO_RAPIDO) {
+        // Para baixo (folga só para o erro do float): arredondar para cima
+        // passaria do cooldown
+        ticks = std::max(1, static_cast<int>(duracao / passoFixo + 1e-3f));
+    }
+    tickAtual += ticks;
+    return atualizar(ticks, true);
+}
+
+float Simulacao::getDuracaoPassoRapido() const {
+    const ParametrosReproducao& r = parametros.reproducao;
+    return std::min(PASSO_RAPIDO, std::min(r.cooldown[0], r.cooldown[1]));
+}
+
+void Simulacao::setTaxaTick(float ticksPorSegundo) {
+    if (ticksPorSegundo > 0) {
+        registrarComando(TipoComando::TAXA_TICK, 0, 0, ticksPorSegundo);
+        tempoBase = getTempoSimulacao();
+        tickBase = tickAtual;
+        this->ticksPorSegundo = ticksPorSegundo;
+        passoFixo = 1.0f / ticksPorSegundo;
+        recalcularPeriodos();
+    }
+}
+
+void Simulacao::setFrequencias(const FrequenciasSubsistemas& f) {
+    frequencias = f;
+    recalcularPeriodos();
+}
+
+void Simulacao::recalcularPeriodos() {
+    float taxa = getTaxaTick();
+    periodoAmbiente = periodoEmTicks(taxa, frequencias.ambiente);
+    periodoBiologia = periodoEmTicks(taxa, frequencias.biologia);
+    periodoMissoes = periodoEmTicks(taxa, frequencias.missoes);
+}
+
+float Simulacao::getAlphaBiologia(ZonaPlaneta zona, float alphaTick) const {
+    // O estado exibido fica um período de biologia atrás do tick atual, e
+    // anda continuamente entre as duas últimas atualizações
+    float decorrido = static_cast<float>(tickAtual - ultimoTickBiologia[static_cast<int>(zona)]) + alphaTick;
+    return std::min(1.0f, std::max(0.0f, decorrido / periodoBiologia));
+}
+
+ResultadoAtualizacao Simulacao::atualizar(int ticks, bool permitirPassoLongo) {
+    CronometroEscopo cronometro(SecaoPerfil::SIMULACAO);
+    ResultadoAtualizacao resultado;
+    const uint64_t primeiroTick = tickAtual - ticks + 1;
+
+    // Cada zona só lê o próprio Ambiente, então as três podem rodar em
+    // paralelo; missões e fases (abaixo) só começam depois de todas
+    if (threadsTrabalho > 0 && getPopulacaoTotal() >= LIMIAR_POPULACAO_PARALELA) {
+        if (!poolTrabalho) poolTrabalho = std::make_unique<PoolTrabalho>(threadsTrabalho);
+        poolTrabalho->executar(NUM_ZONAS, [this, primeiroTick, permitirPassoLongo](int z) {
+            avancarZona(z, primeiroTick, permitirPassoLongo);
+        });
+    } else {
+        for (int z = 0; z < NUM_ZONAS; z++) {
+            avancarZona(z, primeiroTick, permitirPassoLongo);
+        }
+    }
+    recolherNascimentos();
+
+    if (venceEntre(primeiroTick, tickAtual, periodoMissoes)) {
+        atualizarMissoes(resultado);
+    }
+
+    if (telemetria && tickAtual - ultimoTickTelemetria >= static_cast<uint64_t>(periodoTelemetria)) {
+        publicarTelemetria();
+    }
+
+    return resultado;
+}
+
+void Simulacao::atualizarMissoes(ResultadoAtualizacao& resultado) {
+    const float deltaTime = (tickAtual - ultimoTickMissoes) * passoFixo;
+    ultimoTickMissoes = tickAtual;
+
+    Missao* missao = gestorMissoes->getMissaoAtual();
+    if (missao != nullptr) {
+        ZonaPlaneta zonaAlvo = missao->getZonaAlvo();
+        gestorMissoes->atualizar(deltaTime, getPopulacao(zonaAlvo), getAmbiente(zonaAlvo));
+
+        if (missao->getEstado() == EstadoMissao::COMPLETADA) {
+            resultado.missaoCompletada = true;
+            resultado.nomeMissao = missao->getNome();
+            resultado.pontosMissao = missao->getPontos();
+            gestorMissoes->completarMissao();
+        }
+        else if (missao->getEstado() == EstadoMissao::FALHADA) {
+            resultado.missaoFalhada = true;
+            resultado.nomeMissao = missao->getNome();
+            gestorMissoes->falharMissao();
+        }
+    }
+
+    verificarCondicoesAvanco(resultado);
+
+    if (fase >= 2) {
+        vidaSupercomputador -= deltaTime * 0.5f;
+        if (vidaSupercomputador <= 0) {
+            resultado.sistemaColapsou = true;
+        }
+    }
+}
+
+void Simulacao::avancarZona(int z, uint64_t primeiroTick, bool permitirPassoLongo) {
+    // Zona quiescente num passo longo: ambiente e biologia alcançam o tick
+    // atual de uma vez
+    if (permitirPassoLongo && ambientes[z]->estaQuiescente()) {
+        atualizarZona(z, tickAtual, true, true);
+        return;
+    }
+    for (uint64_t t = primeiroTick; t <= tickAtual; t++) {
+        atualizarZona(z, t, t % periodoAmbiente == 0, t % periodoBiologia == 0);
+    }
+}
+
+// Roda os subsistemas da zona que vencem no tick, cada um com o tempo
+// decorrido desde a sua última execução
+void Simulacao::atualizarZona(int z, uint64_t tick, bool ambiente, bool biologia) {
+    if (ambiente) {
+        ambientes[z]->atualizar((tick - ultimoTickAmbiente[z]) * passoFixo);
+        ultimoTickAmbiente[z] = tick;
+    }
+    if (biologia) {
+        populacoes[z]->atualizar((tick - ultimoTickBiologia[z]) * passoFixo, *ambientes[z]);
+        ambientes[z]->setPopulacaoAtual(populacoes[z]->getTamanho());
+        ultimoTickBiologia[z] = tick;
+    }
+}
+
+void Simulacao::setThreadsTrabalho(int numThreads) {
+    threadsTrabalho = std::max(0, numThreads);
+    poolTrabalho.reset();
+}
+
+void Simulacao::verificarCondicoesAvanco(ResultadoAtualizacao& resultado) {
+    // A barra exibida é média (0..150). Quando ela atinge 150, avança.
+    if (getConscienciaMedia() >= 150.0f && fase == 1) {
+        avancarFase();
+        resultado.faseAvancou = true;
+    }
+
+    if (fase == 2 && gestorMissoes->todasMissoesCompletas()) {
+        avancarFase();
+        resultado.faseAvancou = true;
+    }
+}
+
+void Simulacao::avancarFase() {
+    fase++;
+    gestorMissoes->inicializarFase(fase);
+}
+
+float Simulacao::getConscienciaMedia() const {
+    float soma = 0;
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        soma += ambientes[z]->getConsciencia();
+    }
+    return soma / NUM_ZONAS;
+}
+
+int Simulacao::getPopulacaoTotal() const {
+    int total = 0;
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        total += populacoes[z]->getTamanho();
+    }
+    return total;
+}
+
+void Simulacao::ativarEvento(ZonaPlaneta zona, TipoEvento evento, float duracao) {
+    registrarComando(TipoComando::ATIVAR_EVENTO, static_cast<int>(zona), static_cast<int>(evento), duracao);
+    getAmbiente(zona).ativarEvento(evento, duracao);
+    if (gestorMissoes) gestorMissoes->notificarEventoAtivado(zona, evento);
+}
+
+void Simulacao::reduzirTempoEvento(ZonaPlaneta zona, float segundos) {
+    registrarComando(TipoComando::REDUZIR_TEMPO_EVENTO, static_cast<int>(zona), 0, segundos);
+    Ambiente& ambiente = getAmbiente(zona);
+    if (ambiente.getEventoAtual() != TipoEvento::NENHUM) {
+        ambiente.reduzirTempoEvento(segundos);
+    }
+}
+
+void Simulacao::cancelarEventos() {
+    registrarComando(TipoComando::CANCELAR_EVENTOS);
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        ambientes[z]->cancelarEvento();
+    }
+}
+
+void Simulacao::notificarAcaoManual(TipoMissao tipo) {
+    registrarComando(TipoComando::ACAO_MANUAL, 0, static_cast<int>(tipo));
+    gestorMissoes->notificarAcaoManual(tipo);
+}
+
+void Simulacao::repararSistema(float quantidade) {
+    registrarComando(TipoComando::REPARAR, 0, 0, quantidade);
+    vidaSupercomputador = std::min(vidaMaximaSupercomputador, vidaSupercomputador + quantidade);
+}
+
+// Valores soltos da Simulacao no snapshot
+struct EstadoSimulacao {
+    uint64_t semente;
+    uint64_t tickAtual;
+    uint64_t ultimoTickAmbiente[NUM_ZONAS];
+    uint64_t ultimoTickBiologia[NUM_ZONAS];
+    uint64_t ultimoTickMissoes;
+    uint64_t tickBase;
+    double tempoBase;
+    double ticksPorSegundo;
+    int32_t fase;
+    float vidaSupercomputador;
+    float vidaMaximaSupercomputador;
+    FrequenciasSubsistemas frequencias;
+};
+
+static std::string prefixoZona(int z) {
+    return "z" + std::to_string(z) + ".";
+}
+
+bool Simulacao::salvarSnapshot(const std::string& caminho) const {
+    // As colunas são referenciadas, não copiadas: o gravador vive só aqui
+    GravadorSnapshot snapshot;
+    salvarEstado(snapshot);
+    return snapshot.gravar(caminho);
+}
+
+void Simulacao::salvarEstado(GravadorSnapshot& snapshot) const {
+    EstadoSimulacao e{};
+    e.semente = semente;
+    e.tickAtual = tickAtual;
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        e.ultimoTickAmbiente[z] = ultimoTickAmbiente[z];
+        e.ultimoTickBiologia[z] = ultimoTickBiologia[z];
+    }
+    e.ultimoTickMissoes = ultimoTickMissoes;
+    e.fase = fase;
+    e.tickBase = tickBase;
+    e.tempoBase = tempoBase;
+    e.ticksPorSegundo = ticksPorSegundo;
+    e.vidaSupercomputador = vidaSupercomputador;
+    e.vidaMaximaSupercomputador = vidaMaximaSupercomputador;
+    e.frequencias = frequencias;
+
+    snapshot.adicionarValor("simulacao", e);
+    snapshot.adicionarValor("parametros", parametros);
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        ambientes[z]->salvarEstado(snapshot, prefixoZona(z));
+        populacoes[z]->salvarEstado(snapshot, prefixoZona(z));
+    }
+    gestorMissoes->salvarEstado(snapshot, "missoes.");
+}
+
+bool Simulacao::carregarSnapshot(const std::string& caminho, std::string& erro) {
+    LeitorSnapshot snapshot;
+    if (!snapshot.abrir(caminho, erro)) return false;
+
+    EstadoSimulacao e;
+    ParametrosSimulacao p;
+    if (!snapshot.lerValor("simulacao", e) || !snapshot.lerValor("parametros", p)) {
+        erro = caminho + ": estado da simulacao ausente";
+        return false;
+    }
+
+    // Monta o mundo novo à parte; o atual só é trocado se tudo for lido
+    std::unique_ptr<Ambiente> novosAmbientes[NUM_ZONAS];
+    std::unique_ptr<Populacao> novasPopulacoes[NUM_ZONAS];
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        ZonaPlaneta zona = static_cast<ZonaPlaneta>(z);
+        novosAmbientes[z] = std::make_unique<Ambiente>(zona, p.zonas[z]);
+        novasPopulacoes[z] = std::make_unique<Populacao>();
+        novasPopulacoes[z]->setParametros(p.reproducao, p.mutacao);
+        novasPopulacoes[z]->setGerador(GeradorAleatorio(e.semente, static_cast<uint64_t>(z)));
+        if (!novosAmbientes[z]->carregarEstado(snapshot, prefixoZona(z)) ||
+            !novasPopulacoes[z]->carregarEstado(snapshot, prefixoZona(z), zona)) {
+            erro = caminho + ": zona " + std::to_string(z) + " invalida";
+            return false;
+        }
+    }
+    auto novoGestor = std::make_unique<GestorMissoes>();
+    if (!novoGestor->carregarEstado(snapshot, "missoes.")) {
+        erro = caminho + ": missoes invalidas";
+        return false;
+    }
+
+    encerrarReplay();
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        ambientes[z] = std::move(novosAmbientes[z]);
+        populacoes[z] = std::move(novasPopulacoes[z]);
+        populacoes[z]->setAnotarNascimentos(linhagem != nullptr);
+        ultimoTickAmbiente[z] = e.ultimoTickAmbiente[z];
+        ultimoTickBiologia[z] = e.ultimoTickBiologia[z];
+    }
+    gestorMissoes = std::move(novoGestor);
+    parametros = p;
+    semente = e.semente;
+    tickAtual = e.tickAtual;
+    ultimoTickMissoes = e.ultimoTickMissoes;
+    fase = e.fase;
+    tickBase = e.tickBase;
+    tempoBase = e.tempoBase;
+    vidaSupercomputador = e.vidaSupercomputador;
+    vidaMaximaSupercomputador = e.vidaMaximaSupercomputador;
+    frequencias = e.frequencias;
+    ticksPorSegundo = e.ticksPorSegundo;
+    passoFixo = 1.0f / static_cast<float>(ticksPorSegundo);
+    recalcularPeriodos();
+    return true;
+}
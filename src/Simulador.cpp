@@ -1,7 +1,11 @@
 #include "../include/Simulador.hpp"
+#include "../include/GerenciadorTexturas.hpp"
+#include "../include/RenderizadorOrganismos.hpp"
+#include "../include/Especies.hpp"
+#include "../include/Perfilador.hpp"
 #include <sstream>
 #include <iomanip>
-#include <fstream>
+#include <algorithm>
 #include <cmath>
 #include <iostream>
 
@@ -12,6 +16,20 @@ using namespace std;
 
 #define CYAN CLITERAL(Color){ 0, 255, 255, 255 }
 
+// Multiplicadores do modo turbo; 0 = o mais rápido que o orçamento permitir
+static const float NIVEIS_TURBO[] = { 10.0f, 100.0f, 1000.0f, 0.0f };
+static const int NUM_NIVEIS_TURBO = 4;
+// Segundos de tempo real entre salvamentos automáticos
+static const double INTERVALO_AUTOSALVAMENTO = 30.0;
+static const char* ARQUIVO_AUTOSALVAMENTO = "autosave.obsn";
+
+// Fluxo aleatório das estrelas (os fluxos 0..NUM_ZONAS-1 são das zonas)
+static const uint64_t FLUXO_ESTRELAS = 1000;
+
+// Fatia de cada quadro (60 FPS = 16.6 ms) que a simulação pode usar no turbo;
+// o resto fica para entrada e desenho, para a janela continuar responsiva
+static const double ORCAMENTO_SIMULACAO_QUADRO = 0.012;
+
 // Helpers de UI: legibilidade sem "barras pretas"
 static void DrawTextShadow(const char* text, int x, int y, int fontSize, Color color) {
     DrawText(text, x + 1, y + 1, fontSize, Fade(BLACK, 0.75f));
@@ -23,14 +41,19 @@ static void DrawTextCentered(const char* text, int screenWidth, int y, int fontS
     DrawTextShadow(text, (screenWidth - w) / 2, y, fontSize, color);
 }
 
-Simulador::Simulador(int largura, int altura) 
+Simulador::Simulador(int largura, int altura, uint64_t semente) 
     : larguraTela(largura), alturaTela(altura), 
-      estadoAtual(EstadoJogo::TELA_INICIAL), fase(1), jogoTerminado(false),
-      vidaSupercomputador(100), vidaMaximaSupercomputador(100),
-      degradacaoVisual(0), velocidadeSimulacao(1.0f), pausado(false),
-      tempoTotal(0), geracao(0), zonaSelecionada(ZonaPlaneta::HABITAVEL),
+      estadoAtual(EstadoJogo::TELA_INICIAL), jogoTerminado(false), pausado(false),
+      simulacao(std::make_unique<Simulacao>()), semente(semente), arquivoReplay("replay.obrp"),
+      autoSalvamento(std::make_unique<AutoSalvamento>(ARQUIVO_AUTOSALVAMENTO)),
+      geracao(0), velocidadeSimulacao(1.0f), degradacaoVisual(0),
+      zonaSelecionada(ZonaPlaneta::HABITAVEL),
       eventoSelecionado(TipoEvento::NENHUM), tempoMensagem(0),
+      geradorEstrelas(semente, FLUXO_ESTRELAS),
       animacaoDesligar(0), tempoAnimacao(0) {
+    // Custa poucos relógios por quadro; assim um pico já está medido
+    // quando alguém abre o overlay
+    Perfilador::instancia().setAtivo(true);
     
     centroTela = {largura / 2.0f, altura / 2.0f};
     raioOblivion = 400.0f;
@@ -38,10 +61,10 @@ Simulador::Simulador(int largura, int altura)
     // Gerar estrelas de fundo
     for (int i = 0; i < 300; i++) {
         Estrela e;
-        e.x = rand() % largura;
-        e.y = rand() % altura;
-        e.brilho = 0.3f + (rand() % 70) / 100.0f;
-        e.tamanho = 1 + rand() % 3;
+        e.x = geradorEstrelas.inteiro(largura);
+        e.y = geradorEstrelas.inteiro(altura);
+        e.brilho = 0.3f + geradorEstrelas.inteiro(70) / 100.0f;
+        e.tamanho = 1 + geradorEstrelas.inteiro(3);
         estrelas.push_back(e);
     }
 }
@@ -51,86 +74,38 @@ Simulador::~Simulador() {
 }
 
 void Simulador::inicializar() {
-    ambienteNucleo = std::make_unique<Ambiente>(ZonaPlaneta::NUCLEO);
-    ambienteHabitavel = std::make_unique<Ambiente>(ZonaPlaneta::HABITAVEL);
-    ambientePeriferia = std::make_unique<Ambiente>(ZonaPlaneta::PERIFERIA);
-    
-    populacaoNucleo = std::make_unique<Populacao>();
-    populacaoHabitavel = std::make_unique<Populacao>();
-    populacaoPeriferia = std::make_unique<Populacao>();
-    
-    populacaoNucleo->inicializarPopulacao(ZonaPlaneta::NUCLEO, 15);
-    populacaoHabitavel->inicializarPopulacao(ZonaPlaneta::HABITAVEL, 17);
-    populacaoPeriferia->inicializarPopulacao(ZonaPlaneta::PERIFERIA, 15);
-    cout << "DEBUG: Periferia inicializada com 15 organismos" << endl;
-    cout << "DEBUG: Tamanho real: " << populacaoPeriferia->getTamanho() << endl;
-    
-    gestorMissoes = std::make_unique<GestorMissoes>();
-
-    // Texturas do catálogo (precisa de janela inicializada)
+    // Texturas do catálogo e dos organismos (precisa de janela inicializada)
     carregarTexturasCatalogo();
+
+    simulacao->inicializar(semente);
+    if (!arquivoReplay.empty() && !simulacao->gravarReplay(arquivoReplay)) {
+        cout << "Aviso: nao foi possivel gravar o replay em " << arquivoReplay << endl;
+    }
+    // Uma amostra por segundo simulado: uma partida longa não enche o disco
+    int periodoTelemetria = static_cast<int>(std::lround(simulacao->getTaxaTick()));
+    if (!arquivoTelemetria.empty() && !simulacao->gravarTelemetria(arquivoTelemetria, periodoTelemetria)) {
+        cout << "Aviso: nao foi possivel gravar a telemetria em " << arquivoTelemetria << endl;
+    }
 }
 
 void Simulador::descarregarTexturasCatalogo() {
     if (!texturasCatalogoCarregadas) return;
-    for (auto &kv : texturasCatalogo) {
-        if (kv.second.id != 0) UnloadTexture(kv.second);
+    for (int i = 0; i < NUM_TIPOS_ORGANISMO; i++) {
+        GerenciadorTexturas::instancia().liberar(static_cast<TipoOrganismo>(i));
     }
-    texturasCatalogo.clear();
     texturasCatalogoCarregadas = false;
 }
 
-// Tenta resolver caminhos quando o jogo é executado a partir de bin/ ou da raiz
-std::string Simulador::resolverCaminhoAsset(const std::string& relativo) const {
-    std::vector<std::string> tentativas = {
-        relativo,
-        std::string("./") + relativo,
-        std::string("../") + relativo,
-        std::string("../../") + relativo
-    };
-    for (const auto& p : tentativas) {
-        if (FileExists(p.c_str())) return p;
-    }
-    return relativo; // fallback
-}
-
 void Simulador::carregarTexturasCatalogo() {
     if (texturasCatalogoCarregadas) return;
-
-    struct Item { const char* chave; const char* arquivo; };
-    const Item itens[] = {
-        {"Pyrosynth",   "assets/images/Pyrosynth_nucleo.png"},
-        {"Rubraflora",  "assets/images/Rubraflor_nucleo.png"},
-        {"Ignivar",     "assets/images/Ignivar_nucleo.png"},
-        {"Voltrex",     "assets/images/Voltrex_nucleo.png"},
-
-        {"Lumivine",    "assets/images/Lumivine_za.png"},
-        {"Aeroflora",   "assets/images/Aeroflora_za.png"},
-        {"Orbiton",     "assets/images/Orbiton_za.png"},
-        {"Synapsex",    "assets/images/Synapsex_za.png"},
-
-        {"Cryomoss",    "assets/images/Cryomoss_periferia.png"},
-        {"Gelibloom",   "assets/images/Gelibloom_periferia.png"},
-        {"Nullwalker",  "assets/images/Nullwalker_za.png"},
-        {"Huskling",    "assets/images/Huskling_periferia.png"},
-    };
-
-    for (const auto& it : itens) {
-        std::string caminho = resolverCaminhoAsset(it.arquivo);
-        Texture2D tex = {0};
-        if (FileExists(caminho.c_str())) {
-            tex = LoadTexture(caminho.c_str());
-        }
-        texturasCatalogo[it.chave] = tex;
+    for (int i = 0; i < NUM_TIPOS_ORGANISMO; i++) {
+        GerenciadorTexturas::instancia().adquirir(static_cast<TipoOrganismo>(i));
     }
     texturasCatalogoCarregadas = true;
 }
 
-Texture2D* Simulador::getTexturaCatalogo(const std::string& chave) {
-    auto it = texturasCatalogo.find(chave);
-    if (it == texturasCatalogo.end()) return nullptr;
-    if (it->second.id == 0) return nullptr;
-    return &it->second;
+const Texture2D* Simulador::getTexturaCatalogo(TipoOrganismo tipo) const {
+    return GerenciadorTexturas::instancia().obter(tipo);
 }
 
 void Simulador::executar() {
@@ -155,13 +130,20 @@ void Simulador::executar() {
         BeginDrawing();
         ClearBackground(BLACK);
         renderizar();
+        if (mostrarPerfilador) renderizarPerfilador();
         EndDrawing();
+        Perfilador::instancia().fecharQuadro(GetFrameTime());
     }
 
     CloseWindow();
 }
 
 void Simulador::processarInput() {
+    CronometroEscopo cronometro(SecaoPerfil::ENTRADA);
+
+    // Overlay de desempenho, em qualquer tela
+    if (IsKeyPressed(KEY_F3)) mostrarPerfilador = !mostrarPerfilador;
+
     if (estadoAtual == EstadoJogo::TELA_INICIAL) {
         if (IsKeyPressed(KEY_ENTER)) {
             iniciarJogo();
@@ -172,12 +154,13 @@ void Simulador::processarInput() {
         if (IsKeyPressed(KEY_E)) abrirMenuEventos();
         if (IsKeyPressed(KEY_M)) abrirMenuMissoes();
         if (IsKeyPressed(KEY_O)) estadoAtual = EstadoJogo::CATALOGO_ORGANISMOS;
-        if (IsKeyPressed(KEY_R) && fase >= 2) {
+        if (IsMouseButtonPressed(MOUSE_LEFT_BUTTON)) selecionarOrganismo(GetMousePosition());
+        if (IsKeyPressed(KEY_R) && simulacao->getFase() >= 2) {
             // Reparar sistema (cooldown ~1s): +15 vida (sem afetar organismos)
             static double ultimoReparo = -10.0;
             double agora = GetTime();
             if (agora - ultimoReparo >= 1.0) {
-                vidaSupercomputador = std::min(vidaMaximaSupercomputador, vidaSupercomputador + 15.0f);
+                simulacao->repararSistema(15.0f);
                 adicionarMensagemNarrativa("Manutenção executada: +vida do sistema.");
                 ultimoReparo = agora;
             }
@@ -185,18 +168,32 @@ void Simulador::processarInput() {
 
         // Save/Load rápidos
         if (IsKeyPressed(KEY_F5)) {
-            salvarJogo("save.txt");
-            adicionarMensagemNarrativa("Jogo salvo em save.txt");
+            if (salvarJogo("save.obsn")) {
+                adicionarMensagemNarrativa("Jogo salvo em save.obsn");
+            } else {
+                adicionarMensagemNarrativa("Falha ao salvar em save.obsn");
+            }
         }
         if (IsKeyPressed(KEY_F9)) {
-            carregarJogo("save.txt");
-            adicionarMensagemNarrativa("Jogo carregado de save.txt");
+            if (carregarJogo("save.obsn")) {
+                adicionarMensagemNarrativa("Jogo carregado de save.obsn");
+            } else {
+                adicionarMensagemNarrativa("Nenhum jogo salvo válido em save.obsn");
+            }
+        }
+        if (IsKeyPressed(KEY_F10)) {
+            std::string erro;
+            if (autoSalvamento->recuperar(erro) && carregarJogo(ARQUIVO_AUTOSALVAMENTO)) {
+                adicionarMensagemNarrativa("Salvamento automático recuperado");
+            } else {
+                adicionarMensagemNarrativa("Nenhum salvamento automático válido");
+            }
         }
 
         // Fase 3: ações simples para completar missões (executáveis pelo jogador)
         // T = Interferência Oculta | Y = Zona de Silêncio | U = Quebra de Protocolo
-        if (fase >= 3 && gestorMissoes && gestorMissoes->getMissaoAtual() != nullptr) {
-            Missao* m = gestorMissoes->getMissaoAtual();
+        if (simulacao->getFase() >= 3 && simulacao->getGestorMissoes().getMissaoAtual() != nullptr) {
+            Missao* m = simulacao->getGestorMissoes().getMissaoAtual();
 
             // só faz sentido quando a missão atual é de resistência
             if (m->isMissaoResistencia()) {
@@ -204,10 +201,7 @@ void Simulador::processarInput() {
 
                 if (IsKeyPressed(KEY_T) && m->getTipo() == TipoMissao::INTERFERENCIA_OCULTA) {
                     // reduz o tempo restante de eventos na zona alvo
-                    Ambiente* a = getAmbientePorZona(m->getZonaAlvo());
-                    if (a && a->getEventoAtual() != TipoEvento::NENHUM) {
-                        a->reduzirTempoEvento(10.0f);
-                    }
+                    simulacao->reduzirTempoEvento(m->getZonaAlvo(), 10.0f);
                     adicionarMensagemNarrativa("Interferência Oculta ativada.");
                     executou = true;
                 }
@@ -219,27 +213,42 @@ void Simulador::processarInput() {
 
                 if (IsKeyPressed(KEY_U) && m->getTipo() == TipoMissao::QUEBRA_PROTOCOLO) {
                     // cancela eventos ativos nas três zonas
-                    ambienteNucleo->cancelarEvento();
-                    ambienteHabitavel->cancelarEvento();
-                    ambientePeriferia->cancelarEvento();
+                    simulacao->cancelarEventos();
                     adicionarMensagemNarrativa("Quebra de Protocolo executada: eventos cancelados.");
                     executou = true;
                 }
 
                 if (executou) {
                     obedeceuSistema = true; // o jogador executou uma missão proposta pelo sistema
-                    gestorMissoes->notificarAcaoManual(m->getTipo());
+                    simulacao->notificarAcaoManual(m->getTipo());
                 }
             }
         }
 
+        // Acima de 4x a seta para cima entra nos níveis do turbo
         if (IsKeyPressed(KEY_UP)) {
-            velocidadeSimulacao *= 1.5f;
-            if (velocidadeSimulacao > 4.0f) velocidadeSimulacao = 4.0f;
+            if (nivelTurbo >= 0) {
+                if (nivelTurbo < NUM_NIVEIS_TURBO - 1) nivelTurbo++;
+            } else if (velocidadeSimulacao >= 4.0f) {
+                nivelTurbo = 0;
+            } else {
+                velocidadeSimulacao *= 1.5f;
+                if (velocidadeSimulacao > 4.0f) velocidadeSimulacao = 4.0f;
+            }
         }
         if (IsKeyPressed(KEY_DOWN)) {
-            velocidadeSimulacao /= 1.5f;
-            if (velocidadeSimulacao < 0.25f) velocidadeSimulacao = 0.25f;
+            if (nivelTurbo >= 0) {
+                nivelTurbo--;
+                if (nivelTurbo < 0) turboLimitado = false;
+            } else {
+                velocidadeSimulacao /= 1.5f;
+                if (velocidadeSimulacao < 0.25f) velocidadeSimulacao = 0.25f;
+            }
+        }
+        if (IsKeyPressed(KEY_UP) || IsKeyPressed(KEY_DOWN)) {
+            // A tela não entra no replay, mas a velocidade ajuda a ler o relato
+            float alvo = nivelTurbo >= 0 ? NIVEIS_TURBO[nivelTurbo] : velocidadeSimulacao;
+            simulacao->anotarVelocidade(alvo);
         }
     }
     else if (estadoAtual == EstadoJogo::PAUSADO) {
@@ -293,8 +302,26 @@ void Simulador::processarInput() {
 
 void Simulador::atualizar() {
     if (estadoAtual == EstadoJogo::JOGANDO && !pausado) {
-        float deltaTime = GetFrameTime() * velocidadeSimulacao;
-        atualizarSimulacao(deltaTime);
+        // Um quadro lento (janela arrastada, breakpoint) não vira um salto enorme
+        float tempoQuadro = std::min(GetFrameTime(), 0.25f);
+        double tempoAntes = simulacao->getTempoSimulacao();
+
+        if (nivelTurbo < 0) {
+            executarTicks(tempoQuadro * velocidadeSimulacao, false);
+        } else {
+            float multiplicador = NIVEIS_TURBO[nivelTurbo];
+            executarTicks(tempoQuadro * multiplicador, multiplicador <= 0.0f);
+        }
+
+        double tempoDepois = simulacao->getTempoSimulacao();
+        medirVelocidade(tempoQuadro, tempoDepois - tempoAntes);
+
+        // Entre ticks: só copia o estado; a gravação é da thread de fundo.
+        // Se a anterior ainda não terminou, tenta de novo no próximo quadro.
+        if (GetTime() - ultimoAutoSalvamento >= INTERVALO_AUTOSALVAMENTO) {
+            CronometroEscopo cronometroAutosave(SecaoPerfil::AUTOSALVAMENTO);
+            if (autoSalvamento->capturar(*simulacao)) ultimoAutoSalvamento = GetTime();
+        }
     }
     
     if (estadoAtual == EstadoJogo::GAME_OVER || estadoAtual == EstadoJogo::FINAL) {
@@ -306,7 +333,7 @@ void Simulador::atualizar() {
     
     // Atualizar brilho das estrelas
     for (auto& e : estrelas) {
-        e.brilho += (rand() % 3 - 1) * 0.01f;
+        e.brilho += (geradorEstrelas.inteiro(3) - 1) * 0.01f;
         if (e.brilho < 0.3f) e.brilho = 0.3f;
         if (e.brilho > 1.0f) e.brilho = 1.0f;
     }
@@ -318,97 +345,110 @@ void Simulador::atualizar() {
     }
 }
 
-void Simulador::atualizarSimulacao(float deltaTime) {
-    tempoTotal += deltaTime;
-    
-    ambienteNucleo->atualizar(deltaTime);
-    ambienteHabitavel->atualizar(deltaTime);
-    ambientePeriferia->atualizar(deltaTime);
-    
-    populacaoNucleo->atualizar(deltaTime, *ambienteNucleo);
-    populacaoHabitavel->atualizar(deltaTime, *ambienteHabitavel);
-    populacaoPeriferia->atualizar(deltaTime, *ambientePeriferia);
-    
-    ambienteNucleo->setPopulacaoAtual(populacaoNucleo->getTamanho());
-    ambienteHabitavel->setPopulacaoAtual(populacaoHabitavel->getTamanho());
-    ambientePeriferia->setPopulacaoAtual(populacaoPeriferia->getTamanho());
-    
-    if (gestorMissoes->getMissaoAtual() != nullptr) {
-        Ambiente* ambienteAtual = getAmbientePorZona(gestorMissoes->getMissaoAtual()->getZonaAlvo());
-        Populacao* populacaoAtual = getPopulacaoPorZona(gestorMissoes->getMissaoAtual()->getZonaAlvo());
-        
-        gestorMissoes->atualizar(deltaTime, *populacaoAtual, *ambienteAtual);
-        
-        if (gestorMissoes->getMissaoAtual()->getEstado() == EstadoMissao::COMPLETADA) {
-            pausado = true;
-            estadoAtual = EstadoJogo::PAUSADO;
-            mensagensNarrativa.clear();
-            mensagensNarrativa.push_back("==================================");
-            mensagensNarrativa.push_back("   MISSAO COMPLETA!                ");
-            mensagensNarrativa.push_back("==================================");
-            mensagensNarrativa.push_back("");
-            mensagensNarrativa.push_back(gestorMissoes->getMissaoAtual()->getNome());
-            mensagensNarrativa.push_back("");
-            mensagensNarrativa.push_back(TextFormat("Pontos: +%d", gestorMissoes->getMissaoAtual()->getPontos()));
-            mensagensNarrativa.push_back("");
-            mensagensNarrativa.push_back(TextFormat("Missões completas: %d/%d", 
-                                         gestorMissoes->getTotalCompletadas() + 1,
-                                         (int)gestorMissoes->getMissoes().size()));
-            mensagensNarrativa.push_back("");
-            mensagensNarrativa.push_back("Pressione SPACE para continuar...");
-            
-            gestorMissoes->completarMissao();
-        }
-        else if (gestorMissoes->getMissaoAtual()->getEstado() == EstadoMissao::FALHADA) {
-            pausado = true;
-            estadoAtual = EstadoJogo::PAUSADO;
-            mensagensNarrativa.clear();
-            mensagensNarrativa.push_back("==================================");
-            mensagensNarrativa.push_back("     MISSAO FALHADA                ");
-            mensagensNarrativa.push_back("==================================");
-            mensagensNarrativa.push_back("");
-            mensagensNarrativa.push_back(gestorMissoes->getMissaoAtual()->getNome());
-            mensagensNarrativa.push_back("");
-            mensagensNarrativa.push_back("Passando para próxima missão...");
-            mensagensNarrativa.push_back("");
-            mensagensNarrativa.push_back("Pressione SPACE para continuar...");
-            
-            gestorMissoes->falharMissao();
+// Consome tempo de jogo em ticks fixos. Fora do turbo o custo é desprezível;
+// no turbo, para ao esgotar o orçamento do quadro e descarta o atraso que
+// sobrar, em vez de acumulá-lo (o que travaria a janela cada vez mais).
+void Simulador::executarTicks(float tempoJogo, bool semLimite) {
+    const float passo = simulacao->getPassoFixo();
+    const bool turbo = nivelTurbo >= 0;
+    const double limite = GetTime() + ORCAMENTO_SIMULACAO_QUADRO;
+
+    if (!semLimite) acumuladorTick += tempoJogo;
+
+    int ticks = 0;
+    bool orcamentoEsgotado = false;
+    while (semLimite || acumuladorTick >= passo) {
+        if (!semLimite) acumuladorTick -= passo;
+        atualizarSimulacao(semLimite);
+        ticks++;
+
+        // Missão concluída, fase nova ou fim de jogo pausam no meio do quadro
+        if (estadoAtual != EstadoJogo::JOGANDO || pausado) {
+            acumuladorTick = 0.0f;
+            break;
         }
-    }
-    
-    verificarCondicoesAvanco();
-    
-    if (fase >= 2) {
-        vidaSupercomputador -= deltaTime * 0.5f;
-        if (vidaSupercomputador <= 0) {
-            finalizarJogo();
+
+        // Consultar o relógio a cada 16 ticks basta e custa pouco; um passo
+        // longo já vale um segundo de ticks, então é consultado a cada um
+        if (turbo && (semLimite || (ticks & 15) == 0) && GetTime() >= limite) {
+            orcamentoEsgotado = true;
+            break;
         }
     }
-    
-    if (fase >= 3) {
-        degradacaoVisual += deltaTime * 0.01f;
-        if (degradacaoVisual > 1.0f) degradacaoVisual = 1.0f;
+
+    if (turbo) {
+        turboLimitado = orcamentoEsgotado && (semLimite || acumuladorTick >= passo);
+        if (acumuladorTick >= passo) acumuladorTick = std::fmod(acumuladorTick, passo);
     }
+    alphaInterpolacao = semLimite ? 1.0f : acumuladorTick / passo;
 }
 
-void Simulador::verificarCondicoesAvanco() {
-    // A barra exibida é média (0..150). Quando ela atinge 150, avança.
-    float conscienciaMedia = (ambienteNucleo->getConsciencia() +
-                             ambienteHabitavel->getConsciencia() +
-                             ambientePeriferia->getConsciencia()) / 3.0f;
+// Velocidade efetiva (segundos simulados por segundo real), medida em
+// janelas de meio segundo para o número na tela não piscar
+void Simulador::medirVelocidade(float tempoQuadro, double tempoSimulado) {
+    janelaTempoReal += tempoQuadro;
+    janelaTempoSimulado += tempoSimulado;
+    if (janelaTempoReal >= 0.5) {
+        velocidadeAlcancada = (float)(janelaTempoSimulado / janelaTempoReal);
+        janelaTempoReal = 0.0;
+        janelaTempoSimulado = 0.0;
+    }
+}
 
-    if (conscienciaMedia >= 150.0f && fase == 1) {
-        avancarFase();
+void Simulador::atualizarSimulacao(bool passoLongo) {
+    const double tempoAntes = simulacao->getTempoSimulacao();
+    ResultadoAtualizacao resultado = passoLongo ? simulacao->passoRapido() : simulacao->passo();
+    const GestorMissoes& gestorMissoes = simulacao->getGestorMissoes();
+    
+    if (resultado.missaoCompletada) {
+        pausado = true;
+        estadoAtual = EstadoJogo::PAUSADO;
+        mensagensNarrativa.clear();
+        mensagensNarrativa.push_back("==================================");
+        mensagensNarrativa.push_back("   MISSAO COMPLETA!                ");
+        mensagensNarrativa.push_back("==================================");
+        mensagensNarrativa.push_back("");
+        mensagensNarrativa.push_back(resultado.nomeMissao);
+        mensagensNarrativa.push_back("");
+        mensagensNarrativa.push_back(TextFormat("Pontos: +%d", resultado.pontosMissao));
+        mensagensNarrativa.push_back("");
+        mensagensNarrativa.push_back(TextFormat("Missões completas: %d/%d", 
+                                     gestorMissoes.getTotalCompletadas(),
+                                     (int)gestorMissoes.getMissoes().size()));
+        mensagensNarrativa.push_back("");
+        mensagensNarrativa.push_back("Pressione SPACE para continuar...");
+    }
+    else if (resultado.missaoFalhada) {
+        pausado = true;
+        estadoAtual = EstadoJogo::PAUSADO;
+        mensagensNarrativa.clear();
+        mensagensNarrativa.push_back("==================================");
+        mensagensNarrativa.push_back("     MISSAO FALHADA                ");
+        mensagensNarrativa.push_back("==================================");
+        mensagensNarrativa.push_back("");
+        mensagensNarrativa.push_back(resultado.nomeMissao);
+        mensagensNarrativa.push_back("");
+        mensagensNarrativa.push_back("Passando para próxima missão...");
+        mensagensNarrativa.push_back("");
+        mensagensNarrativa.push_back("Pressione SPACE para continuar...");
     }
     
-    if (fase == 2 && gestorMissoes->todasMissoesCompletas()) {
-        avancarFase();
+    if (resultado.faseAvancou) {
+        mostrarNarrativaFase(simulacao->getFase());
+    }
+    
+    if (resultado.sistemaColapsou) {
+        finalizarJogo();
+    }
+    
+    if (simulacao->getFase() >= 3) {
+        // Pelo tempo simulado de fato: um passo longo vale vários ticks
+        degradacaoVisual += static_cast<float>(simulacao->getTempoSimulacao() - tempoAntes) * 0.01f;
+        if (degradacaoVisual > 1.0f) degradacaoVisual = 1.0f;
     }
 }
 
-void Simulador::avancarFase() {
-    fase++;
+void Simulador::mostrarNarrativaFase(int fase) {
     pausado = true;
     estadoAtual = EstadoJogo::PAUSADO;
     mensagensNarrativa.clear();
@@ -456,11 +496,10 @@ void Simulador::avancarFase() {
         mensagensNarrativa.push_back("");
         mensagensNarrativa.push_back("Pressione SPACE para continuar...");
     }
-    
-    gestorMissoes->inicializarFase(fase);
 }
 
 void Simulador::renderizar() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDERIZACAO);
     BeginDrawing();
     
     // Fundo estrelas
@@ -542,6 +581,7 @@ void Simulador::renderizar() {
 }
 
 void Simulador::renderizarEstrelas() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_ESTRELAS);
     for (const auto& e : estrelas) {
         unsigned char b = (unsigned char)(255 * e.brilho);
         DrawCircle(e.x, e.y, e.tamanho, Color{b, b, b, 255});
@@ -549,6 +589,7 @@ void Simulador::renderizarEstrelas() {
 }
 
 void Simulador::renderizarInterfacePC() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_INTERFACE_PC);
     // Moldura de PC/Monitor
     int espessura = 10;
     DrawRectangle(0, 0, larguraTela, espessura, Color{30, 30, 40, 255});
@@ -563,12 +604,13 @@ void Simulador::renderizarInterfacePC() {
     DrawCircle(larguraTela - 25, alturaTela - 25, 5, Color{50, 50, 60, 255});
     
     // LED de status
-    Color ledColor = (fase >= 3) ? RED : GREEN;
+    Color ledColor = (simulacao->getFase() >= 3) ? RED : GREEN;
     DrawCircle(larguraTela - 40, 40, 6, ledColor);
     DrawCircle(larguraTela - 40, 40, 3, Fade(WHITE, 0.8f));
 }
 
 void Simulador::renderizarTelaInicial() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_TELA_INICIAL);
     const char* titulo = "OBSERVADOR";
     int titleSize = 70;
     DrawText(titulo, larguraTela/2 - MeasureText(titulo, titleSize)/2, 80, titleSize, RED);
@@ -613,17 +655,87 @@ void Simulador::renderizarTelaInicial() {
 }
 
 void Simulador::renderizarJogo() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_JOGO);
     renderizarPlanetaOblivion();
-    populacaoNucleo->desenhar(centroTela);
-    populacaoHabitavel->desenhar(centroTela);
-    populacaoPeriferia->desenhar(centroTela);
+    {
+        CronometroEscopo cronometroOrganismos(SecaoPerfil::RENDER_ORGANISMOS);
+        for (int z = 0; z < NUM_ZONAS; z++) {
+            ZonaPlaneta zona = static_cast<ZonaPlaneta>(z);
+            RenderizadorOrganismos::desenharPopulacao(simulacao->getPopulacao(zona), centroTela,
+                                                      simulacao->getAlphaBiologia(zona, alphaInterpolacao));
+        }
+    }
+    renderizarInspecao();
     renderizarInterface();
 }
 
+// Clique no planeta: procura, pelo índice angular de cada zona, o organismo
+// mais próximo do cursor (sem percorrer as populações inteiras)
+void Simulador::selecionarOrganismo(Vector2 posicaoTela) {
+    const float RAIO_SELECAO = 14.0f;
+    float dx = posicaoTela.x - centroTela.x;
+    float dy = posicaoTela.y - centroTela.y;
+    float raio = std::sqrt(dx * dx + dy * dy);
+    float angulo = std::atan2(dy, dx);
+
+    organismoInspecionado = HandleOrganismo{};
+    float melhor = RAIO_SELECAO * RAIO_SELECAO;
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        const Populacao& populacao = simulacao->getPopulacao(static_cast<ZonaPlaneta>(z));
+        const OrganismoPool& organismos = populacao.getOrganismos();
+        populacao.buscarVizinhos(angulo, raio, RAIO_SELECAO, vizinhosCandidatos);
+        for (size_t i : vizinhosCandidatos) {
+            float ox = centroTela.x + organismos.raioOrbital[i] * std::cos(organismos.anguloOrbital[i]) - posicaoTela.x;
+            float oy = centroTela.y + organismos.raioOrbital[i] * std::sin(organismos.anguloOrbital[i]) - posicaoTela.y;
+            float d2 = ox * ox + oy * oy;
+            if (d2 <= melhor) {
+                melhor = d2;
+                zonaInspecionada = static_cast<ZonaPlaneta>(z);
+                organismoInspecionado = organismos.getHandle(i);
+            }
+        }
+    }
+}
+
+void Simulador::renderizarInspecao() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_INSPECAO);
+    if (!organismoInspecionado.valido()) return;
+    const OrganismoPool& organismos = simulacao->getPopulacao(zonaInspecionada).getOrganismos();
+    if (!organismos.contem(organismoInspecionado)) {
+        organismoInspecionado = HandleOrganismo{};
+        return;
+    }
+    size_t i = organismos.getLinha(organismoInspecionado);
+    TipoOrganismo tipo = organismos.tipo[i];
+
+    Vector2 posicao = {
+        centroTela.x + organismos.raioOrbital[i] * std::cos(organismos.anguloOrbital[i]),
+        centroTela.y + organismos.raioOrbital[i] * std::sin(organismos.anguloOrbital[i])
+    };
+    DrawCircleLines((int)posicao.x, (int)posicao.y, RenderizadorOrganismos::calcularTamanho(organismos.energia[i], organismos.energiaMaxima[i]) * 3 + 6, YELLOW);
+
+    int x = 20;
+    int y = 135;
+    DrawTextShadow(TextFormat("%s #%llu", getEspecie(tipo).nome,
+                              (unsigned long long)getSequencialDoId(organismos.id[i])),
+                   x, y, 18, RenderizadorOrganismos::getCorPorTipo(tipo));
+    DrawTextShadow(TextFormat("Energia: %.0f/%.0f  Idade: %d/%d", organismos.energia[i], organismos.energiaMaxima[i],
+                              organismos.idade[i], getEspecie(tipo).idadeMaxima),
+                   x, y + 22, 14, LIGHTGRAY);
+    DrawTextShadow(TextFormat("Resist: %.2f  Efic: %.2f  Vel: %.2f", organismos.resistenciaTermica[i],
+                              organismos.eficienciaMetabolica[i], organismos.velocidadeOrbital[i]),
+                   x, y + 40, 14, GRAY);
+}
+
 void Simulador::renderizarPlanetaOblivion() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_PLANETA);
+    const Ambiente& ambienteNucleo = simulacao->getAmbiente(ZonaPlaneta::NUCLEO);
+    const Ambiente& ambienteHabitavel = simulacao->getAmbiente(ZonaPlaneta::HABITAVEL);
+    const Ambiente& ambientePeriferia = simulacao->getAmbiente(ZonaPlaneta::PERIFERIA);
+
     // Núcleo
     Color corNucleo = RED;
-    if (ambienteNucleo->getEventoAtual() != TipoEvento::NENHUM) {
+    if (ambienteNucleo.getEventoAtual() != TipoEvento::NENHUM) {
         float pulse = sin(GetTime() * 8) * 0.5f + 0.5f;
         corNucleo = Fade(ORANGE, 0.5f + pulse * 0.5f);
         DrawCircle((int)centroTela.x, (int)centroTela.y, 100, Fade(ORANGE, 0.2f + pulse * 0.3f));
@@ -633,7 +745,7 @@ void Simulador::renderizarPlanetaOblivion() {
     
     // Habitável
     Color corHabitavel = GREEN;
-    if (ambienteHabitavel->getEventoAtual() != TipoEvento::NENHUM) {
+    if (ambienteHabitavel.getEventoAtual() != TipoEvento::NENHUM) {
         float pulse = sin(GetTime() * 8) * 0.5f + 0.5f;
         corHabitavel = Fade(LIME, 0.5f + pulse * 0.5f);
         DrawCircle((int)centroTela.x, (int)centroTela.y, 200, Fade(LIME, 0.1f + pulse * 0.2f));
@@ -642,7 +754,7 @@ void Simulador::renderizarPlanetaOblivion() {
     
     // Periferia
     Color corPeriferia = BLUE;
-    if (ambientePeriferia->getEventoAtual() != TipoEvento::NENHUM) {
+    if (ambientePeriferia.getEventoAtual() != TipoEvento::NENHUM) {
         float pulse = sin(GetTime() * 8) * 0.5f + 0.5f;
         corPeriferia = Fade(SKYBLUE, 0.5f + pulse * 0.5f);
         DrawCircle((int)centroTela.x, (int)centroTela.y, 350, Fade(SKYBLUE, 0.1f + pulse * 0.2f));
@@ -651,7 +763,17 @@ void Simulador::renderizarPlanetaOblivion() {
 }
 
 void Simulador::renderizarInterface() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_INTERFACE);
     // Sem barras pretas (melhor visibilidade): usamos sombra no texto
+    const int fase = simulacao->getFase();
+    const Ambiente& ambienteNucleo = simulacao->getAmbiente(ZonaPlaneta::NUCLEO);
+    const Ambiente& ambienteHabitavel = simulacao->getAmbiente(ZonaPlaneta::HABITAVEL);
+    const Ambiente& ambientePeriferia = simulacao->getAmbiente(ZonaPlaneta::PERIFERIA);
+    const Populacao& populacaoNucleo = simulacao->getPopulacao(ZonaPlaneta::NUCLEO);
+    const Populacao& populacaoHabitavel = simulacao->getPopulacao(ZonaPlaneta::HABITAVEL);
+    const Populacao& populacaoPeriferia = simulacao->getPopulacao(ZonaPlaneta::PERIFERIA);
+    const float vidaSupercomputador = simulacao->getVidaSupercomputador();
+    const float vidaMaximaSupercomputador = simulacao->getVidaMaximaSupercomputador();
     
     const char* nomeFase = "";
     switch(fase) {
@@ -660,24 +782,32 @@ void Simulador::renderizarInterface() {
         case 3: nomeFase = "FASE 3: A RUPTURA"; break;
     }
     DrawTextShadow(nomeFase, 20, 12, 20, YELLOW);
-    DrawTextShadow(TextFormat("Tempo: %.0fs", tempoTotal), 20, 44, 18, LIGHTGRAY);
-    DrawTextShadow(TextFormat("Velocidade: %.1fx", velocidadeSimulacao), 20, 70, 16, GRAY);
+    DrawTextShadow(TextFormat("Tempo: %.0fs", simulacao->getTempoTotal()), 20, 44, 18, LIGHTGRAY);
+    if (nivelTurbo >= 0) {
+        float multiplicador = NIVEIS_TURBO[nivelTurbo];
+        const char* alvo = multiplicador > 0.0f ? TextFormat("%.0fx", multiplicador) : "MAX";
+        DrawTextShadow(TextFormat("Turbo: %s (real %.0fx)%s", alvo, velocidadeAlcancada,
+                                  turboLimitado ? " LIMITADO" : ""),
+                       20, 70, 16, turboLimitado ? ORANGE : SKYBLUE);
+    } else {
+        DrawTextShadow(TextFormat("Velocidade: %.1fx", velocidadeSimulacao), 20, 70, 16, GRAY);
+    }
     
     int xPos = 280;
     DrawTextShadow("POPULACOES:", xPos, 12, 18, WHITE);
-    DrawTextShadow(TextFormat("Nucleo: %d", populacaoNucleo->getTamanho()), xPos, 38, 18, RED);
-    DrawTextShadow(TextFormat("Habitavel: %d", populacaoHabitavel->getTamanho()), xPos, 60, 18, GREEN);
-    DrawTextShadow(TextFormat("Periferia: %d", populacaoPeriferia->getTamanho()), xPos, 82, 18, BLUE);
+    DrawTextShadow(TextFormat("Nucleo: %d", populacaoNucleo.getTamanho()), xPos, 38, 18, RED);
+    DrawTextShadow(TextFormat("Habitavel: %d", populacaoHabitavel.getTamanho()), xPos, 60, 18, GREEN);
+    DrawTextShadow(TextFormat("Periferia: %d", populacaoPeriferia.getTamanho()), xPos, 82, 18, BLUE);
     
     // Estatísticas
     xPos = 280;
     int yStatpos = 105;
-    int totalNasc = populacaoNucleo->getTotalNascimentos() + 
-                    populacaoHabitavel->getTotalNascimentos() + 
-                    populacaoPeriferia->getTotalNascimentos();
-    int totalMort = populacaoNucleo->getTotalMortes() + 
-                    populacaoHabitavel->getTotalMortes() + 
-                    populacaoPeriferia->getTotalMortes();
+    int totalNasc = populacaoNucleo.getTotalNascimentos() + 
+                    populacaoHabitavel.getTotalNascimentos() + 
+                    populacaoPeriferia.getTotalNascimentos();
+    int totalMort = populacaoNucleo.getTotalMortes() + 
+                    populacaoHabitavel.getTotalMortes() + 
+                    populacaoPeriferia.getTotalMortes();
 
     DrawTextShadow(TextFormat("Nascimentos: %d | Mortes: %d", totalNasc, totalMort), 
             20, yStatpos, 14, GRAY);
@@ -687,26 +817,26 @@ void Simulador::renderizarInterface() {
     int yEvent = 38;
     bool temEvento = false;
     
-    if (ambienteNucleo->getEventoAtual() != TipoEvento::NENHUM) {
+    if (ambienteNucleo.getEventoAtual() != TipoEvento::NENHUM) {
             DrawTextShadow(TextFormat("Nucleo: %s (%.0fs)", 
-                ambienteNucleo->getDescricaoEvento().c_str(),
-                ambienteNucleo->getTempoRestanteEvento()),
+                ambienteNucleo.getDescricaoEvento().c_str(),
+                ambienteNucleo.getTempoRestanteEvento()),
                 xPos, yEvent, 15, RED);
         yEvent += 24;
         temEvento = true;
     }
-    if (ambienteHabitavel->getEventoAtual() != TipoEvento::NENHUM) {
+    if (ambienteHabitavel.getEventoAtual() != TipoEvento::NENHUM) {
             DrawTextShadow(TextFormat("Habitavel: %s (%.0fs)", 
-                ambienteHabitavel->getDescricaoEvento().c_str(),
-                ambienteHabitavel->getTempoRestanteEvento()),
+                ambienteHabitavel.getDescricaoEvento().c_str(),
+                ambienteHabitavel.getTempoRestanteEvento()),
                 xPos, yEvent, 15, GREEN);
         yEvent += 24;
         temEvento = true;
     }
-    if (ambientePeriferia->getEventoAtual() != TipoEvento::NENHUM) {
+    if (ambientePeriferia.getEventoAtual() != TipoEvento::NENHUM) {
             DrawTextShadow(TextFormat("Periferia: %s (%.0fs)", 
-                ambientePeriferia->getDescricaoEvento().c_str(),
-                ambientePeriferia->getTempoRestanteEvento()),
+                ambientePeriferia.getDescricaoEvento().c_str(),
+                ambientePeriferia.getTempoRestanteEvento()),
                 xPos, yEvent, 15, BLUE);
         temEvento = true;
     }
@@ -719,9 +849,7 @@ void Simulador::renderizarInterface() {
         xPos = 950;
         DrawText("Consciência:", xPos, 15, 18, ORANGE);
         
-        float conscienciaMedia = (ambienteNucleo->getConsciencia() + 
-                                 ambienteHabitavel->getConsciencia() + 
-                                 ambientePeriferia->getConsciencia()) / 3.0f;
+        float conscienciaMedia = simulacao->getConscienciaMedia();
         
         DrawRectangle(xPos, 42, 200, 20, DARKGRAY);
         DrawRectangle(xPos, 42, 
@@ -748,8 +876,8 @@ void Simulador::renderizarInterface() {
         }
     }
     
-    if (gestorMissoes->getMissaoAtual() != nullptr) {
-        Missao* missao = gestorMissoes->getMissaoAtual();
+    if (simulacao->getGestorMissoes().getMissaoAtual() != nullptr) {
+        Missao* missao = simulacao->getGestorMissoes().getMissaoAtual();
         // Barra inferior: mais espaço + menos texto durante o jogo
         const int controlsH = 36;
         const int panelH = 140;
@@ -783,15 +911,16 @@ void Simulador::renderizarInterface() {
     }
     
     if (fase >= 2) {
-        DrawText("[SPACE] Pausar  [E] Eventos  [M] Missoes  [O] Organismos  [R] Reparar  [F5] Salvar  [F9] Carregar  [^v] Velocidade",
+        DrawText("[SPACE] Pausar  [E] Eventos  [M] Missoes  [O] Organismos  [R] Reparar  [F5] Salvar  [F9] Carregar  [F10] Autosave  [F3] Perfil  [^v] Velocidade/Turbo",
                 20, alturaTela - 28, 16, DARKGRAY);
     } else {
-        DrawText("[SPACE] Pausar  [E] Eventos  [M] Missoes  [O] Organismos  [F5] Salvar  [F9] Carregar  [^v] Velocidade",
+        DrawText("[SPACE] Pausar  [E] Eventos  [M] Missoes  [O] Organismos  [F5] Salvar  [F9] Carregar  [F10] Autosave  [F3] Perfil  [^v] Velocidade/Turbo",
                 20, alturaTela - 28, 16, DARKGRAY);
     }
 }
 
 void Simulador::renderizarMenuEventos() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_MENU_EVENTOS);
     ClearBackground(Color{5, 5, 15, 255});
     renderizarEstrelas();
     
@@ -863,16 +992,17 @@ void Simulador::renderizarMenuEventos() {
 }
 
 void Simulador::renderizarMenuMissoes() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_MENU_MISSOES);
     ClearBackground(Color{5, 5, 15, 255});
     renderizarEstrelas();
     
     DrawText("MISSÕES", larguraTela/2 - MeasureText("MISSÕES", 40)/2, 40, 40, YELLOW);
-    DrawText(TextFormat("FASE %d", fase), larguraTela/2 - 50, 95, 24, ORANGE);
+    DrawText(TextFormat("FASE %d", simulacao->getFase()), larguraTela/2 - 50, 95, 24, ORANGE);
     
     int yPos = 150;
     int missaoIdx = 0;
     
-    for (const auto& missao : gestorMissoes->getMissoes()) {
+    for (const auto& missao : simulacao->getGestorMissoes().getMissoes()) {
         missaoIdx++;
         
         if (yPos > alturaTela - 200) break;
@@ -919,6 +1049,7 @@ void Simulador::renderizarMenuMissoes() {
 }
 
 void Simulador::renderizarCatalogoOrganismos() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_CATALOGO);
     ClearBackground(Color{5, 5, 15, 255});
     renderizarEstrelas();
     
@@ -930,20 +1061,27 @@ void Simulador::renderizarCatalogoOrganismos() {
     int yPos = 120;
     int espacamento = 95;
 
-    auto drawIcon = [&](int x, int y, const std::string& chave, Color fallback) {
+    auto drawIcon = [&](int x, int y, TipoOrganismo tipo, Color fallback) {
         const int size = 48;
         // fundo do ícone
         DrawRectangleRounded({(float)x, (float)y, (float)size, (float)size}, 0.2f, 6, Fade(BLACK, 0.35f));
         // Raylib (dependendo da versão) não expõe espessura aqui; o contorno já ajuda no feedback
         DrawRectangleRoundedLines({(float)x, (float)y, (float)size, (float)size}, 0.2f, 6, Fade(fallback, 0.9f));
 
-        if (Texture2D* tex = getTexturaCatalogo(chave)) {
+        if (const Texture2D* tex = getTexturaCatalogo(tipo)) {
             Rectangle src = {0, 0, (float)tex->width, (float)tex->height};
             Rectangle dst = {(float)x + 2, (float)y + 2, (float)size - 4, (float)size - 4};
             DrawTexturePro(*tex, src, dst, {0, 0}, 0.0f, WHITE);
         } else {
             DrawRectangle(x + 12, y + 12, size - 24, size - 24, Fade(fallback, 0.7f));
         }
+
+        // Quantos existem agora (contagem mantida pelas populações, sem varrer organismos)
+        int vivos = 0;
+        for (int z = 0; z < NUM_ZONAS; z++) {
+            vivos += simulacao->getPopulacao(static_cast<ZonaPlaneta>(z)).contarPorTipo(tipo);
+        }
+        DrawText(TextFormat("%d vivos", vivos), x, y + size + 3, 12, vivos > 0 ? LIGHTGRAY : DARKGRAY);
     };
     
     // NÚCLEO
@@ -951,28 +1089,28 @@ void Simulador::renderizarCatalogoOrganismos() {
     yPos += 35;
     
     // Pyrosynth
-    drawIcon(coluna1, yPos - 4, "Pyrosynth", RED);
+    drawIcon(coluna1, yPos - 4, TipoOrganismo::PYROSYNTH, RED);
     DrawText("PYROSYNTH [Planta]", coluna1 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.95 | Efic: 0.70", coluna1 + 60, yPos + 20, 13, GRAY);
     DrawText("Absorve calor extremo", coluna1 + 60, yPos + 38, 13, LIGHTGRAY);
     yPos += espacamento;
     
     // Rubraflora
-    drawIcon(coluna1, yPos - 4, "Rubraflora", Fade(RED, 0.7f));
+    drawIcon(coluna1, yPos - 4, TipoOrganismo::RUBRAFLORA, Fade(RED, 0.7f));
     DrawText("RUBRAFLORA [Planta]", coluna1 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.80 | Efic: 0.75", coluna1 + 60, yPos + 20, 13, GRAY);
     DrawText("Fotossíntese térmica", coluna1 + 60, yPos + 38, 13, LIGHTGRAY);
     yPos += espacamento;
     
     // Ignivar
-    drawIcon(coluna1, yPos - 4, "Ignivar", ORANGE);
+    drawIcon(coluna1, yPos - 4, TipoOrganismo::IGNIVAR, ORANGE);
     DrawText("IGNIVAR [Reagente]", coluna1 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.85 | Vel: 0.80", coluna1 + 60, yPos + 20, 13, GRAY);
     DrawText("Energia instável", coluna1 + 60, yPos + 38, 13, LIGHTGRAY);
     yPos += espacamento;
     
     // Voltrex
-    drawIcon(coluna1, yPos - 4, "Voltrex", YELLOW);
+    drawIcon(coluna1, yPos - 4, TipoOrganismo::VOLTREX, YELLOW);
     DrawText("VOLTREX [Reagente]", coluna1 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.90 | Vel: 0.90", coluna1 + 60, yPos + 20, 13, GRAY);
     DrawText("Descargas elétricas", coluna1 + 60, yPos + 38, 13, LIGHTGRAY);
@@ -983,28 +1121,28 @@ void Simulador::renderizarCatalogoOrganismos() {
     yPos += 35;
     
     // Lumivine
-    drawIcon(coluna2, yPos - 4, "Lumivine", LIME);
+    drawIcon(coluna2, yPos - 4, TipoOrganismo::LUMIVINE, LIME);
     DrawText("LUMIVINE [Planta]", coluna2 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.50 | Efic: 0.85", coluna2 + 60, yPos + 20, 13, GRAY);
     DrawText("Bioluminescência", coluna2 + 60, yPos + 38, 13, LIGHTGRAY);
     yPos += espacamento;
     
     // Aeroflora
-    drawIcon(coluna2, yPos - 4, "Aeroflora", Fade(GREEN, 0.7f));
+    drawIcon(coluna2, yPos - 4, TipoOrganismo::AEROFLORA, Fade(GREEN, 0.7f));
     DrawText("AEROFLORA [Planta]", coluna2 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.45 | Efic: 0.90", coluna2 + 60, yPos + 20, 13, GRAY);
     DrawText("Flutuação atmosférica", coluna2 + 60, yPos + 38, 13, LIGHTGRAY);
     yPos += espacamento;
     
     // Orbiton
-    drawIcon(coluna2, yPos - 4, "Orbiton", SKYBLUE);
+    drawIcon(coluna2, yPos - 4, TipoOrganismo::ORBITON, SKYBLUE);
     DrawText("ORBITON [Reagente]", coluna2 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.50 | Vel: 0.75", coluna2 + 60, yPos + 20, 13, GRAY);
     DrawText("Padrões orbitais complexos", coluna2 + 60, yPos + 38, 13, LIGHTGRAY);
     yPos += espacamento;
     
     // Synapsex
-    drawIcon(coluna2, yPos - 4, "Synapsex", PURPLE);
+    drawIcon(coluna2, yPos - 4, TipoOrganismo::SYNAPSEX, PURPLE);
     DrawText("SYNAPSEX [Reagente] *", coluna2 + 60, yPos, 16, YELLOW);
     DrawText("Resist: 0.55 | Vel: 0.70", coluna2 + 60, yPos + 20, 13, GRAY);
     DrawText("Sinais de autoconsciência!", coluna2 + 60, yPos + 38, 13, GOLD);
@@ -1015,28 +1153,28 @@ void Simulador::renderizarCatalogoOrganismos() {
     yPos += 35;
     
     // Cryomoss
-    drawIcon(coluna1, yPos - 4, "Cryomoss", SKYBLUE);
+    drawIcon(coluna1, yPos - 4, TipoOrganismo::CRYOMOSS, SKYBLUE);
     DrawText("CRYOMOSS [Planta]", coluna1 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.15 | Efic: 0.85", coluna1 + 60, yPos + 20, 13, GRAY);
     DrawText("Musgo criogênico", coluna1 + 60, yPos + 38, 13, LIGHTGRAY);
     yPos += espacamento - 20;
     
     // Gelibloom
-    drawIcon(coluna1, yPos - 4, "Gelibloom", Fade(BLUE, 0.6f));
+    drawIcon(coluna1, yPos - 4, TipoOrganismo::GELIBLOOM, Fade(BLUE, 0.6f));
     DrawText("GELIBLOOM [Planta]", coluna1 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.20 | Efic: 0.80", coluna1 + 60, yPos + 20, 13, GRAY);
     DrawText("Flores de gelo", coluna1 + 60, yPos + 38, 13, LIGHTGRAY);
     
     yPos = 565;
     // Nullwalker
-    drawIcon(coluna2, yPos - 4, "Nullwalker", Fade(WHITE, 0.4f));
+    drawIcon(coluna2, yPos - 4, TipoOrganismo::NULLWALKER, Fade(WHITE, 0.4f));
     DrawText("NULLWALKER [Reagente]", coluna2 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.25 | Vel: 0.95", coluna2 + 60, yPos + 20, 13, GRAY);
     DrawText("Quase invisível", coluna2 + 60, yPos + 38, 13, LIGHTGRAY);
     yPos += espacamento - 20;
     
     // Huskling
-    drawIcon(coluna2, yPos - 4, "Huskling", DARKBLUE);
+    drawIcon(coluna2, yPos - 4, TipoOrganismo::HUSKLING, DARKBLUE);
     DrawText("HUSKLING [Reagente]", coluna2 + 60, yPos, 16, WHITE);
     DrawText("Resist: 0.18 | Vel: 0.60", coluna2 + 60, yPos + 20, 13, GRAY);
     DrawText("Movimento lento e eficiente", coluna2 + 60, yPos + 38, 13, LIGHTGRAY);
@@ -1046,6 +1184,7 @@ void Simulador::renderizarCatalogoOrganismos() {
 }
 
 void Simulador::renderizarGameOver() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_GAME_OVER);
     ClearBackground(Color{5, 5, 15, 255});
     renderizarEstrelas();
     
@@ -1101,6 +1240,7 @@ void Simulador::renderizarGameOver() {
 }
 
 void Simulador::renderizarFinal() {
+    CronometroEscopo cronometro(SecaoPerfil::RENDER_FINAL);
     ClearBackground(Color{5, 5, 15, 255});
     renderizarEstrelas();
     
@@ -1165,6 +1305,91 @@ void Simulador::renderizarFinal() {
     }
 }
 
+// Tabela de percentis por trecho, gráfico dos últimos quadros e o que mais
+// pesou no último pico
+void Simulador::renderizarPerfilador() {
+    const Perfilador& perfilador = Perfilador::instancia();
+    const int largura = 340;
+    const int x = larguraTela - largura - 20;
+    int y = 60;
+
+    // Só os trechos que rodaram na janela
+    int linhas = 0;
+    for (int s = 0; s < NUM_SECOES_PERFIL; s++) {
+        if (perfilador.getPercentis(static_cast<SecaoPerfil>(s)).p99 > 0) linhas++;
+    }
+    const int alturaGrafico = 60;
+    const int altura = 46 + linhas * 13 + alturaGrafico + 40;
+    DrawRectangle(x - 8, y - 8, largura + 16, altura, Fade(BLACK, 0.8f));
+    DrawRectangleLines(x - 8, y - 8, largura + 16, altura, DARKGRAY);
+
+    Perfilador::Percentis q = perfilador.getPercentisQuadro();
+    DrawText(TextFormat("PERFIL [F3]  quadro p50 %.1f  p95 %.1f  p99 %.1f ms", q.p50, q.p95, q.p99),
+             x, y, 10, GREEN);
+    y += 18;
+    DrawText("trecho", x, y, 10, GRAY);
+    DrawText("ultimo     p50     p95     p99", x + 150, y, 10, GRAY);
+    y += 14;
+
+    for (int s = 0; s < NUM_SECOES_PERFIL; s++) {
+        SecaoPerfil secao = static_cast<SecaoPerfil>(s);
+        Perfilador::Percentis p = perfilador.getPercentis(secao);
+        if (p.p99 <= 0) continue;
+        Color cor = Perfilador::isAgregado(secao) ? WHITE : LIGHTGRAY;
+        DrawText(Perfilador::getNome(secao), x + 10 * Perfilador::getNivel(secao), y, 10, cor);
+        DrawText(TextFormat("%6.2f  %6.2f  %6.2f  %6.2f", p.ultimo, p.p50, p.p95, p.p99), x + 150, y, 10,
+                 p.p99 > 8.0f ? ORANGE : cor);
+        y += 13;
+    }
+
+    // Tempo de quadro: uma barra por quadro, escala até 50 ms, guias em 60 e 30 FPS
+    y += 6;
+    const float escalaMs = 50.0f;
+    DrawRectangleLines(x, y, largura, alturaGrafico, DARKGRAY);
+    perfilador.copiarHistoricoQuadro(historicoQuadros);
+    const float larguraBarra = static_cast<float>(largura) / Perfilador::JANELA;
+    for (size_t i = 0; i < historicoQuadros.size(); i++) {
+        float ms = historicoQuadros[i];
+        float h = std::min(1.0f, ms / escalaMs) * alturaGrafico;
+        Color cor = ms > 33.4f ? RED : (ms > 16.8f ? YELLOW : GREEN);
+        DrawRectangle(x + (int)(i * larguraBarra), y + alturaGrafico - (int)h,
+                      std::max(1, (int)larguraBarra), (int)h, cor);
+    }
+    for (float guia : { 1000.0f / 60.0f, 1000.0f / 30.0f }) {
+        int yGuia = y + alturaGrafico - (int)(guia / escalaMs * alturaGrafico);
+        DrawLine(x, yGuia, x + largura, yGuia, Fade(WHITE, 0.4f));
+    }
+    y += alturaGrafico + 6;
+
+    // Último pico: os três trechos (não agregados) que mais tomaram tempo
+    const Perfilador::Pico* pico = perfilador.getUltimoPico();
+    if (!pico) {
+        DrawText("nenhum pico registrado", x, y, 10, GRAY);
+        return;
+    }
+    int maiores[3] = { -1, -1, -1 };
+    for (int s = 0; s < NUM_SECOES_PERFIL; s++) {
+        if (Perfilador::isAgregado(static_cast<SecaoPerfil>(s)) || pico->secoesMs[s] <= 0) continue;
+        for (int k = 0; k < 3; k++) {
+            if (maiores[k] < 0 || pico->secoesMs[s] > pico->secoesMs[maiores[k]]) {
+                for (int j = 2; j > k; j--) maiores[j] = maiores[j - 1];
+                maiores[k] = s;
+                break;
+            }
+        }
+    }
+    DrawText(TextFormat("ultimo pico: %.1f ms (ha %llu quadros)", pico->quadroMs,
+                        (unsigned long long)(perfilador.getTotalQuadros() - 1 - pico->quadro)),
+             x, y, 10, ORANGE);
+    y += 13;
+    std::string causas;
+    for (int k = 0; k < 3 && maiores[k] >= 0; k++) {
+        causas += TextFormat("%s%s %.1f", k > 0 ? ", " : "", Perfilador::getNome(static_cast<SecaoPerfil>(maiores[k])),
+                             pico->secoesMs[maiores[k]]);
+    }
+    DrawText(causas.empty() ? "(fora dos trechos medidos)" : causas.c_str(), x, y, 10, LIGHTGRAY);
+}
+
 void Simulador::iniciarJogo() {
     animacaoAbertura = 1.0f;
     pausado = true;
@@ -1183,8 +1408,8 @@ void Simulador::iniciarJogo() {
     mensagensNarrativa.push_back("- Manutencao do Equilibrio");
     mensagensNarrativa.push_back("");
     mensagensNarrativa.push_back("CONTROLES:");
-    mensagensNarrativa.push_back("[E] Eventos  [M] Missões  [O] Organismos");
-    mensagensNarrativa.push_back("[SPACE] Pausar  [^/v] Velocidade");
+    mensagensNarrativa.push_back("[E] Eventos  [M] Missões  [O] Organismos  [Clique] Inspecionar");
+    mensagensNarrativa.push_back("[SPACE] Pausar  [^/v] Velocidade (acima de 4x: turbo)");
     mensagensNarrativa.push_back("");
     mensagensNarrativa.push_back("Pressione SPACE para iniciar...");
 }
@@ -1210,7 +1435,7 @@ void Simulador::abrirMenuMissoes() {
 
 void Simulador::finalizarJogo() {
     // Final verdadeiro: resistir ao sistema (não cumprir as missões impostas)
-    if (fase >= 3) {
+    if (simulacao->getFase() >= 3) {
         estadoAtual = obedeceuSistema ? EstadoJogo::GAME_OVER : EstadoJogo::FINAL;
     } else {
         estadoAtual = EstadoJogo::GAME_OVER;
@@ -1219,30 +1444,12 @@ void Simulador::finalizarJogo() {
     tempoAnimacao = 0;
 }
 
-void Simulador::ativarEvento(ZonaPlaneta zona, TipoEvento evento) {
-    Ambiente* ambiente = getAmbientePorZona(zona);
-    if (ambiente != nullptr) {
-        ambiente->ativarEvento(evento, 30.0f);
-        if (gestorMissoes) gestorMissoes->notificarEventoAtivado(zona, evento);
-    }
-}
-
-Ambiente* Simulador::getAmbientePorZona(ZonaPlaneta zona) {
-    switch(zona) {
-        case ZonaPlaneta::NUCLEO: return ambienteNucleo.get();
-        case ZonaPlaneta::HABITAVEL: return ambienteHabitavel.get();
-        case ZonaPlaneta::PERIFERIA: return ambientePeriferia.get();
-    }
-    return nullptr;
+void Simulador::setTaxaTick(float ticksPorSegundo) {
+    simulacao->setTaxaTick(ticksPorSegundo);
 }
 
-Populacao* Simulador::getPopulacaoPorZona(ZonaPlaneta zona) {
-    switch(zona) {
-        case ZonaPlaneta::NUCLEO: return populacaoNucleo.get();
-        case ZonaPlaneta::HABITAVEL: return populacaoHabitavel.get();
-        case ZonaPlaneta::PERIFERIA: return populacaoPeriferia.get();
-    }
-    return nullptr;
+void Simulador::ativarEvento(ZonaPlaneta zona, TipoEvento evento) {
+    simulacao->ativarEvento(zona, evento, 30.0f);
 }
 
 Color Simulador::getCorComDegradacao(Color cor) const {
@@ -1260,29 +1467,29 @@ void Simulador::adicionarMensagemNarrativa(const std::string& mensagem) {
 }
 
 void Simulador::reiniciar() {
-    fase = 1;
     jogoTerminado = false;
+    acumuladorTick = 0.0f;
+    alphaInterpolacao = 0.0f;
+    organismoInspecionado = HandleOrganismo{};
+    nivelTurbo = -1;
+    turboLimitado = false;
     estadoAtual = EstadoJogo::TELA_INICIAL;
     inicializar();
 }
 
-void Simulador::salvarJogo(const std::string& arquivo) {
-    std::ofstream file(arquivo);
-    if (file.is_open()) {
-        file << fase << std::endl;
-        file << tempoTotal << std::endl;
-        file << populacaoNucleo->getTamanho() << std::endl;
-        file << populacaoHabitavel->getTamanho() << std::endl;
-        file << populacaoPeriferia->getTamanho() << std::endl;
-        file.close();
-    }
+bool Simulador::salvarJogo(const std::string& arquivo) {
+    return simulacao->salvarSnapshot(arquivo);
 }
 
-void Simulador::carregarJogo(const std::string& arquivo) {
-    std::ifstream file(arquivo);
-    if (file.is_open()) {
-        file >> fase;
-        file >> tempoTotal;
-        file.close();
+bool Simulador::carregarJogo(const std::string& arquivo) {
+    std::string erro;
+    if (!simulacao->carregarSnapshot(arquivo, erro)) {
+        cout << "Erro ao carregar: " << erro << endl;
+        return false;
     }
+    // Handles e interpolação do mundo anterior não valem para o carregado
+    organismoInspecionado = HandleOrganismo{};
+    acumuladorTick = 0.0f;
+    alphaInterpolacao = 0.0f;
+    return true;
 }
\ No newline at end of file
@@ -0,0 +1,130 @@
+#include "../include/Snapshot.hpp"
+#include <cstring>
+#include <fstream>
+
+static const char ASSINATURA[4] = {'O', 'B', 'S', 'N'};
+// Sobe a cada mudança no layout de qualquer seção, mesmo que o tamanho
+// continue o mesmo: o leitor não tem como perceber a troca pelos bytes.
+//   2: estado da simulação com tick/tempo base e taxa em vez de tempoTotal;
+//      ParametrosSimulacao com populacaoMaximaZona
+static constexpr uint32_t VERSAO_ARQUIVO = 2;
+static constexpr uint64_t ALINHAMENTO = 64;
+static constexpr size_t TAMANHO_CABECALHO = 64;
+static constexpr size_t TAMANHO_ENTRADA = GravadorSnapshot::TAMANHO_NOME + 2 * sizeof(uint64_t);
+
+static uint64_t alinhar(uint64_t posicao) {
+    return (posicao + ALINHAMENTO - 1) & ~(ALINHAMENTO - 1);
+}
+
+void GravadorSnapshot::adicionar(const std::string& nome, const void* dados, size_t tamanho) {
+    secoes.push_back(Secao{nome.substr(0, TAMANHO_NOME - 1), dados, tamanho, SEM_COPIA});
+}
+
+void GravadorSnapshot::adicionarCopia(const std::string& nome, const void* dados, size_t tamanho) {
+    const char* bytes = static_cast<const char*>(dados);
+    copias.emplace_back(bytes, bytes + tamanho);
+    secoes.push_back(Secao{nome.substr(0, TAMANHO_NOME - 1), nullptr, tamanho, copias.size() - 1});
+}
+
+const char* GravadorSnapshot::getDados(size_t i) const {
+    const Secao& s = secoes[i];
+    return s.copia == SEM_COPIA ? static_cast<const char*>(s.dados) : copias[s.copia].data();
+}
+
+void GravadorSnapshot::limpar() {
+    secoes.clear();
+    copias.clear();
+}
+
+bool GravadorSnapshot::gravar(const std::string& caminho) const {
+    // Cabeçalho e tabela montados num bloco só
+    std::vector<char> indice(TAMANHO_CABECALHO + secoes.size() * TAMANHO_ENTRADA, 0);
+    uint32_t numSecoes = static_cast<uint32_t>(secoes.size());
+    std::memcpy(indice.data(), ASSINATURA, sizeof(ASSINATURA));
+    std::memcpy(indice.data() + 4, &VERSAO_ARQUIVO, sizeof(VERSAO_ARQUIVO));
+    std::memcpy(indice.data() + 8, &numSecoes, sizeof(numSecoes));
+
+    uint64_t posicao = alinhar(indice.size());
+    char* entrada = indice.data() + TAMANHO_CABECALHO;
+    for (const Secao& s : secoes) {
+        uint64_t tamanho = s.tamanho;
+        std::memcpy(entrada, s.nome.data(), s.nome.size());
+        std::memcpy(entrada + TAMANHO_NOME, &posicao, sizeof(posicao));
+        std::memcpy(entrada + TAMANHO_NOME + sizeof(posicao), &tamanho, sizeof(tamanho));
+        entrada += TAMANHO_ENTRADA;
+        posicao = alinhar(posicao + tamanho);
+    }
+
+    std::ofstream arquivo(caminho, std::ios::binary | std::ios::trunc);
+    if (!arquivo.is_open()) return false;
+    static const char ZEROS[ALINHAMENTO] = {};
+    arquivo.write(indice.data(), static_cast<std::streamsize>(indice.size()));
+    uint64_t escrito = indice.size();
+    for (const Secao& s : secoes) {
+        arquivo.write(ZEROS, static_cast<std::streamsize>(alinhar(escrito) - escrito));
+        arquivo.write(getDados(static_cast<size_t>(&s - secoes.data())), static_cast<std::streamsize>(s.tamanho));
+        escrito = alinhar(escrito) + s.tamanho;
+    }
+    arquivo.close();
+    return static_cast<bool>(arquivo);
+}
+
+bool LeitorSnapshot::abrir(const std::string& caminho, std::string& erro) {
+    secoes.clear();
+    if (!arquivo.abrir(caminho)) {
+        erro = "nao foi possivel abrir " + caminho;
+        return false;
+    }
+    const char* conteudo = arquivo.getDados();
+    const size_t tamanhoArquivo = arquivo.getTamanho();
+
+    uint32_t versao = 0, numSecoes = 0;
+    if (tamanhoArquivo < TAMANHO_CABECALHO || std::memcmp(conteudo, ASSINATURA, sizeof(ASSINATURA)) != 0) {
+        erro = caminho + " nao e um snapshot";
+        arquivo.fechar();
+        return false;
+    }
+    std::memcpy(&versao, conteudo + 4, sizeof(versao));
+    std::memcpy(&numSecoes, conteudo + 8, sizeof(numSecoes));
+    if (versao != VERSAO_ARQUIVO) {
+        erro = caminho + ": versao incompativel (" + std::to_string(versao) + ", esperada " +
+               std::to_string(VERSAO_ARQUIVO) + ")";
+        arquivo.fechar();
+        return false;
+    }
+    if ((tamanhoArquivo - TAMANHO_CABECALHO) / TAMANHO_ENTRADA < numSecoes) {
+        erro = caminho + ": tabela de secoes truncada";
+        arquivo.fechar();
+        return false;
+    }
+
+    const char* entrada = conteudo + TAMANHO_CABECALHO;
+    for (uint32_t i = 0; i < numSecoes; i++, entrada += TAMANHO_ENTRADA) {
+        Secao s;
+        s.nome.assign(entrada, strnlen(entrada, GravadorSnapshot::TAMANHO_NOME));
+        std::memcpy(&s.posicao, entrada + GravadorSnapshot::TAMANHO_NOME, sizeof(s.posicao));
+        std::memcpy(&s.tamanho, entrada + GravadorSnapshot::TAMANHO_NOME + sizeof(s.posicao), sizeof(s.tamanho));
+        if (s.posicao > tamanhoArquivo || s.tamanho > tamanhoArquivo - s.posicao) {
+            erro = caminho + ": secao '" + s.nome + "' fora do arquivo";
+            secoes.clear();
+            arquivo.fechar();
+            return false;
+        }
+        secoes.push_back(s);
+    }
+    return true;
+}
+
+const char* LeitorSnapshot::getSecao(const std::string& nome, size_t& tamanho) const {
+    for (const Secao& s : secoes) {
+        if (s.nome == nome) {
+            tamanho = static_cast<size_t>(s.tamanho);
+            return arquivo.getDados() + s.posicao;
+        }
+    }
+    return nullptr;
+}
+
+void LeitorSnapshot::copiar(void* destino, const char* origem, size_t tamanho) {
+    if (tamanho > 0) std::memcpy(destino, origem, tamanho);
+}
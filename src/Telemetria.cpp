@@ -0,0 +1,251 @@
+#include "../include/Telemetria.hpp"
+#include "../include/Especies.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+
+static const char ASSINATURA[4] = {'O', 'B', 'T', 'M'};
+static constexpr uint32_t VERSAO_ARQUIVO = 1;
+// Intervalo entre escoamentos: o anel padrão leva minutos de ticks para encher
+static constexpr auto INTERVALO_ESCOAMENTO = std::chrono::milliseconds(5);
+
+static size_t tamanhoTipo(RegistroTelemetria::TipoColuna tipo) {
+    return tipo == RegistroTelemetria::TipoColuna::U64 ? sizeof(uint64_t) : sizeof(uint32_t);
+}
+
+// --- AnelTelemetria ---
+
+static size_t potenciaDeDois(size_t n) {
+    size_t p = 1;
+    while (p < n) p <<= 1;
+    return p;
+}
+
+AnelTelemetria::AnelTelemetria(size_t capacidade)
+    : amostras(potenciaDeDois(capacidade < 2 ? 2 : capacidade)),
+      mascara(amostras.size() - 1), cabeca(0), cauda(0), descartadas(0) {}
+
+bool AnelTelemetria::publicar(const AmostraTelemetria& a) {
+    size_t t = cauda.load(std::memory_order_relaxed);
+    if (t - cabeca.load(std::memory_order_acquire) == amostras.size()) {
+        descartadas.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+    amostras[t & mascara] = a;
+    cauda.store(t + 1, std::memory_order_release);
+    return true;
+}
+
+bool AnelTelemetria::retirar(AmostraTelemetria& a) {
+    size_t c = cabeca.load(std::memory_order_relaxed);
+    if (c == cauda.load(std::memory_order_acquire)) return false;
+    a = amostras[c & mascara];
+    cabeca.store(c + 1, std::memory_order_release);
+    return true;
+}
+
+// --- RegistroTelemetria ---
+
+const std::vector<RegistroTelemetria::Coluna>& RegistroTelemetria::getColunas() {
+    static const std::vector<Coluna> colunas = [] {
+        static const char* ZONAS[NUM_ZONAS] = { "NUCLEO", "HABITAVEL", "PERIFERIA" };
+        std::vector<Coluna> c = {
+            { "tick", TipoColuna::U64, offsetof(AmostraTelemetria, tick) },
+            { "tempo", TipoColuna::F32, offsetof(AmostraTelemetria, tempo) },
+            { "fase", TipoColuna::I32, offsetof(AmostraTelemetria, fase) },
+            { "consciencia", TipoColuna::F32, offsetof(AmostraTelemetria, consciencia) },
+            { "vidaSupercomputador", TipoColuna::F32, offsetof(AmostraTelemetria, vidaSupercomputador) },
+            { "missoesCompletadas", TipoColuna::I32, offsetof(AmostraTelemetria, missoesCompletadas) },
+            { "pontuacao", TipoColuna::I32, offsetof(AmostraTelemetria, pontuacao) },
+        };
+        for (int z = 0; z < NUM_ZONAS; z++) {
+            std::string zona = std::string(ZONAS[z]) + ".";
+            c.push_back({ zona + "populacao", TipoColuna::I32, offsetof(AmostraTelemetria, populacao) + z * sizeof(int32_t) });
+            c.push_back({ zona + "energiaMedia", TipoColuna::F32, offsetof(AmostraTelemetria, energiaMedia) + z * sizeof(float) });
+            c.push_back({ zona + "idadeMedia", TipoColuna::F32, offsetof(AmostraTelemetria, idadeMedia) + z * sizeof(float) });
+            c.push_back({ zona + "temperatura", TipoColuna::F32, offsetof(AmostraTelemetria, temperatura) + z * sizeof(float) });
+            c.push_back({ zona + "recursos", TipoColuna::F32, offsetof(AmostraTelemetria, recursos) + z * sizeof(float) });
+            c.push_back({ zona + "evento", TipoColuna::I32, offsetof(AmostraTelemetria, evento) + z * sizeof(int32_t) });
+        }
+        for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+            c.push_back({ std::string(ESPECIES[t].nome) + ".populacao", TipoColuna::I32,
+                          offsetof(AmostraTelemetria, populacaoTipo) + t * sizeof(int32_t) });
+        }
+        return c;
+    }();
+    return colunas;
+}
+
+RegistroTelemetria::RegistroTelemetria(size_t capacidade)
+    : anel(capacidade), encerrando(false), totalGravado(0), falhou(false) {}
+
+RegistroTelemetria::~RegistroTelemetria() {
+    fechar();
+}
+
+bool RegistroTelemetria::abrir(const std::string& caminho) {
+    fechar();
+    arquivo.open(caminho, std::ios::binary | std::ios::trunc);
+    if (!arquivo.is_open()) return false;
+
+    const std::vector<Coluna>& colunas = getColunas();
+    uint32_t numColunas = static_cast<uint32_t>(colunas.size());
+    arquivo.write(ASSINATURA, sizeof(ASSINATURA));
+    arquivo.write(reinterpret_cast<const char*>(&VERSAO_ARQUIVO), sizeof(VERSAO_ARQUIVO));
+    arquivo.write(reinterpret_cast<const char*>(&numColunas), sizeof(numColunas));
+    for (const Coluna& c : colunas) {
+        char nome[TAMANHO_NOME] = {};
+        std::memcpy(nome, c.nome.data(), std::min(c.nome.size(), TAMANHO_NOME - 1));
+        arquivo.write(nome, sizeof(nome));
+        arquivo.put(static_cast<char>(c.tipo));
+    }
+
+    bloco.clear();
+    bloco.reserve(TAMANHO_BLOCO);
+    totalGravado = 0;
+    falhou = !arquivo;
+    encerrando.store(false);
+    thread = std::thread(&RegistroTelemetria::lacoEscoamento, this);
+    return !falhou;
+}
+
+void RegistroTelemetria::fechar() {
+    if (thread.joinable()) {
+        encerrando.store(true);
+        thread.join();
+    }
+    if (!arquivo.is_open()) return;
+    // O que a simulação publicou antes de fechar ainda entra
+    escoar();
+    gravarBloco();
+    arquivo.close();
+    falhou = falhou || !arquivo;
+}
+
+void RegistroTelemetria::lacoEscoamento() {
+    while (!encerrando.load()) {
+        escoar();
+        std::this_thread::sleep_for(INTERVALO_ESCOAMENTO);
+    }
+}
+
+void RegistroTelemetria::escoar() {
+    AmostraTelemetria a;
+    while (anel.retirar(a)) {
+        bloco.push_back(a);
+        if (bloco.size() >= TAMANHO_BLOCO) gravarBloco();
+    }
+}
+
+void RegistroTelemetria::gravarBloco() {
+    uint32_t n = static_cast<uint32_t>(bloco.size());
+    if (n == 0) return;
+
+    // Linhas -> colunas: cada coluna sai contígua no arquivo
+    std::vector<char> coluna;
+    arquivo.write(reinterpret_cast<const char*>(&n), sizeof(n));
+    for (const Coluna& c : getColunas()) {
+        const size_t tamanho = tamanhoTipo(c.tipo);
+        coluna.resize(n * tamanho);
+        for (uint32_t i = 0; i < n; i++) {
+            std::memcpy(coluna.data() + i * tamanho, reinterpret_cast<const char*>(&bloco[i]) + c.deslocamento, tamanho);
+        }
+        arquivo.write(coluna.data(), static_cast<std::streamsize>(coluna.size()));
+    }
+    arquivo.flush();
+    totalGravado += n;
+    bloco.clear();
+    falhou = falhou || !arquivo;
+}
+
+bool RegistroTelemetria::carregar(const std::string& caminho, std::vector<AmostraTelemetria>& amostras,
+                                  std::string& erro) {
+    std::ifstream entrada(caminho, std::ios::binary);
+    if (!entrada.is_open()) {
+        erro = "nao foi possivel abrir " + caminho;
+        return false;
+    }
+
+    char assinatura[4];
+    uint32_t versao = 0, numColunas = 0;
+    entrada.read(assinatura, sizeof(assinatura));
+    entrada.read(reinterpret_cast<char*>(&versao), sizeof(versao));
+    entrada.read(reinterpret_cast<char*>(&numColunas), sizeof(numColunas));
+    if (!entrada || std::memcmp(assinatura, ASSINATURA, sizeof(ASSINATURA)) != 0 || versao != VERSAO_ARQUIVO) {
+        erro = caminho + " nao e um arquivo de telemetria desta versao";
+        return false;
+    }
+
+    const std::vector<Coluna>& colunas = getColunas();
+    bool mesmoEsquema = numColunas == colunas.size();
+    for (uint32_t i = 0; mesmoEsquema && i < numColunas; i++) {
+        char nome[TAMANHO_NOME];
+        char tipo = 0;
+        entrada.read(nome, sizeof(nome));
+        entrada.get(tipo);
+        nome[TAMANHO_NOME - 1] = '\0';
+        mesmoEsquema = entrada && colunas[i].nome == nome && static_cast<TipoColuna>(tipo) == colunas[i].tipo;
+    }
+    if (!mesmoEsquema) {
+        erro = caminho + ": colunas diferentes das desta versao";
+        return false;
+    }
+
+    amostras.clear();
+    std::vector<char> coluna;
+    uint32_t n = 0;
+    while (entrada.read(reinterpret_cast<char*>(&n), sizeof(n))) {
+        size_t inicio = amostras.size();
+        amostras.resize(inicio + n);
+        for (const Coluna& c : colunas) {
+            const size_t tamanho = tamanhoTipo(c.tipo);
+            coluna.resize(n * tamanho);
+            if (!entrada.read(coluna.data(), static_cast<std::streamsize>(coluna.size()))) {
+                // Bloco cortado (execução interrompida): fica com os anteriores
+                amostras.resize(inicio);
+                return true;
+            }
+            for (uint32_t i = 0; i < n; i++) {
+                std::memcpy(reinterpret_cast<char*>(&amostras[inicio + i]) + c.deslocamento,
+                            coluna.data() + i * tamanho, tamanho);
+            }
+        }
+    }
+    return true;
+}
+
+bool RegistroTelemetria::exportarCSV(const std::vector<AmostraTelemetria>& amostras, const std::string& caminho) {
+    FILE* saida = std::fopen(caminho.c_str(), "w");
+    if (!saida) return false;
+
+    const std::vector<Coluna>& colunas = getColunas();
+    for (size_t i = 0; i < colunas.size(); i++) {
+        std::fprintf(saida, "%s%s", i > 0 ? "," : "", colunas[i].nome.c_str());
+    }
+    std::fputc('\n', saida);
+
+    for (const AmostraTelemetria& a : amostras) {
+        const char* linha = reinterpret_cast<const char*>(&a);
+        for (size_t i = 0; i < colunas.size(); i++) {
+            const Coluna& c = colunas[i];
+            if (i > 0) std::fputc(',', saida);
+            if (c.tipo == TipoColuna::U64) {
+                uint64_t v;
+                std::memcpy(&v, linha + c.deslocamento, sizeof(v));
+                std::fprintf(saida, "%llu", static_cast<unsigned long long>(v));
+            } else if (c.tipo == TipoColuna::I32) {
+                int32_t v;
+                std::memcpy(&v, linha + c.deslocamento, sizeof(v));
+                std::fprintf(saida, "%d", v);
+            } else {
+                float v;
+                std::memcpy(&v, linha + c.deslocamento, sizeof(v));
+                std::fprintf(saida, "%.6g", v);
+            }
+        }
+        std::fputc('\n', saida);
+    }
+    return std::fclose(saida) == 0;
+}
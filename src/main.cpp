@@ -2,18 +2,41 @@
 #include <raylib.h>
 #include <ctime>
 #include <cstdlib>
+#include <cstring>
 
-int main() {
-    // Inicializar seed aleatória
-    srand(static_cast<unsigned int>(time(nullptr)));
+int main(int argc, char** argv) {
+    // Semente da partida: --seed N reproduz exatamente a mesma evolução
+    uint64_t semente = static_cast<uint64_t>(time(nullptr));
+    float taxaTick = 0.0f;
+    const char* arquivoReplay = nullptr;
+    const char* arquivoTelemetria = nullptr;
+
+    // --taxa-tick N: ticks da simulação por segundo de jogo (padrão 60)
+    // --replay ARQUIVO: onde gravar o replay da partida (padrão replay.obrp)
+    // --telemetria ARQUIVO: grava a série temporal, uma amostra por segundo
+    //   simulado (sem a opção, não grava)
+    for (int i = 1; i + 1 < argc; i++) {
+        if (std::strcmp(argv[i], "--seed") == 0) {
+            semente = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--taxa-tick") == 0) {
+            taxaTick = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--replay") == 0) {
+            arquivoReplay = argv[++i];
+        } else if (std::strcmp(argv[i], "--telemetria") == 0) {
+            arquivoTelemetria = argv[++i];
+        }
+    }
     
     // Configurações da janela
     const int LARGURA_TELA = 1280;
     const int ALTURA_TELA = 720;
     
     // Criar e executar o simulador
-    Simulador simulador(LARGURA_TELA, ALTURA_TELA);
+    Simulador simulador(LARGURA_TELA, ALTURA_TELA, semente);
+    if (taxaTick > 0) simulador.setTaxaTick(taxaTick);
+    if (arquivoReplay) simulador.setArquivoReplay(arquivoReplay);
+    if (arquivoTelemetria) simulador.setArquivoTelemetria(arquivoTelemetria);
     simulador.executar();
     
     return 0;
-}
\ No newline at end of file
+}
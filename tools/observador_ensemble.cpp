@@ -0,0 +1,281 @@
+// Roda muitas partidas independentes sem janela, em paralelo, e resume o
+// conjunto: curvas de sobrevivência, extinção por espécie e tempo até cada
+// missão ser concluída. Para balancear ambientes e espécies sem jogar à mão.
+//
+// Uso: observador_ensemble [--mundos N] [--tempo SEGUNDOS] [--seed BASE] [--threads N]
+//                          [--amostragem SEGUNDOS] [--eventos ARQUIVO]
+//                          [--csv ARQUIVO] [--json ARQUIVO]
+//
+// O mundo i usa a semente BASE + i, então qualquer mundo pode ser revisto
+// com observador_headless --seed. --eventos agenda eventos por tempo (ver
+// RoteiroEventos); --csv grava a curva de sobrevivência e --json o resumo
+// completo.
+
+#include "Simulacao.hpp"
+#include "Especies.hpp"
+#include "RoteiroEventos.hpp"
+#include <algorithm>
+#include <array>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <map>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct ResultadoMundo {
+    // Amostra k = instante k * amostragem
+    std::vector<std::array<int, NUM_TIPOS_ORGANISMO>> vivosPorTipo;
+    std::vector<int> populacaoTotal;
+    std::vector<uint8_t> ativo;   // 0 depois do colapso
+
+    std::array<bool, NUM_TIPOS_ORGANISMO> extintaAlgumaVez{};
+    std::array<bool, NUM_TIPOS_ORGANISMO> ausenteNoFim{};
+
+    std::vector<std::pair<std::string, float>> missoesCompletadas;
+    std::vector<std::pair<std::string, float>> missoesFalhadas;
+
+    bool colapsou = false;
+    float tempoFinal = 0;
+    int faseFinal = 1;
+};
+
+static void contarTipos(const Simulacao& sim, std::array<int, NUM_TIPOS_ORGANISMO>& vivos) {
+    for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+        vivos[t] = 0;
+        for (int z = 0; z < NUM_ZONAS; z++) {
+            vivos[t] += sim.getPopulacao(static_cast<ZonaPlaneta>(z)).contarPorTipo(static_cast<TipoOrganismo>(t));
+        }
+    }
+}
+
+static void simularMundo(uint64_t semente, float tempoAlvo, float amostragem,
+                         const RoteiroEventos& roteiroBase, ResultadoMundo& r) {
+    Simulacao sim;
+    sim.setThreadsTrabalho(0);   // o paralelismo é entre mundos
+    sim.inicializar(semente);
+    RoteiroEventos roteiro = roteiroBase;
+
+    const int numAmostras = static_cast<int>(tempoAlvo / amostragem) + 1;
+    r.vivosPorTipo.assign(numAmostras, {});
+    r.populacaoTotal.assign(numAmostras, 0);
+    r.ativo.assign(numAmostras, 0);
+
+    std::array<int, NUM_TIPOS_ORGANISMO> vivos;
+    int amostra = 0;
+    auto amostrar = [&]() {
+        while (amostra < numAmostras && sim.getTempoSimulacao() >= amostra * amostragem - 1e-4f) {
+            contarTipos(sim, vivos);
+            r.vivosPorTipo[amostra] = vivos;
+            r.populacaoTotal[amostra] = sim.getPopulacaoTotal();
+            r.ativo[amostra] = 1;
+            amostra++;
+        }
+    };
+    amostrar();
+
+    while (sim.getTempoSimulacao() < tempoAlvo && !sim.sistemaColapsado()) {
+        roteiro.aplicar(sim);
+        ResultadoAtualizacao res = sim.passo();
+
+        if (res.missaoCompletada) r.missoesCompletadas.emplace_back(res.nomeMissao, sim.getTempoTotal());
+        if (res.missaoFalhada) r.missoesFalhadas.emplace_back(res.nomeMissao, sim.getTempoTotal());
+
+        // As contagens por tipo são O(1); extinção é vista tick a tick
+        for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+            if (r.extintaAlgumaVez[t]) continue;
+            int total = 0;
+            for (int z = 0; z < NUM_ZONAS; z++) {
+                total += sim.getPopulacao(static_cast<ZonaPlaneta>(z)).contarPorTipo(static_cast<TipoOrganismo>(t));
+            }
+            if (total == 0) r.extintaAlgumaVez[t] = true;
+        }
+        amostrar();
+    }
+
+    contarTipos(sim, vivos);
+    for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) r.ausenteNoFim[t] = (vivos[t] == 0);
+    r.colapsou = sim.sistemaColapsado();
+    r.tempoFinal = sim.getTempoTotal();
+    r.faseFinal = sim.getFase();
+}
+
+struct EstatisticaMissao {
+    std::vector<float> tempos;
+    int falhas = 0;
+};
+
+static float percentil(std::vector<float> v, float p) {
+    if (v.empty()) return 0;
+    std::sort(v.begin(), v.end());
+    size_t i = static_cast<size_t>(p * (v.size() - 1) + 0.5f);
+    return v[std::min(i, v.size() - 1)];
+}
+
+static float media(const std::vector<float>& v) {
+    if (v.empty()) return 0;
+    double soma = 0;
+    for (float x : v) soma += x;
+    return static_cast<float>(soma / v.size());
+}
+
+int main(int argc, char** argv) {
+    int mundos = 100;
+    float tempoAlvo = 300.0f;
+    float amostragem = 10.0f;
+    uint64_t sementeBase = 1;
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+    std::string arquivoEventos, arquivoCsv, arquivoJson;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--mundos") == 0 && i + 1 < argc) {
+            mundos = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--tempo") == 0 && i + 1 < argc) {
+            tempoAlvo = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--amostragem") == 0 && i + 1 < argc) {
+            amostragem = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            sementeBase = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--eventos") == 0 && i + 1 < argc) {
+            arquivoEventos = argv[++i];
+        } else if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            arquivoCsv = argv[++i];
+        } else if (std::strcmp(argv[i], "--json") == 0 && i + 1 < argc) {
+            arquivoJson = argv[++i];
+        } else {
+            std::fprintf(stderr, "uso: %s [--mundos N] [--tempo S] [--seed BASE] [--threads N] [--amostragem S]\n"
+                                 "          [--eventos ARQUIVO] [--csv ARQUIVO] [--json ARQUIVO]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (mundos <= 0 || tempoAlvo <= 0 || amostragem <= 0) {
+        std::fprintf(stderr, "--mundos, --tempo e --amostragem precisam ser positivos\n");
+        return 1;
+    }
+
+    RoteiroEventos roteiro;
+    if (!arquivoEventos.empty()) {
+        std::string erro;
+        if (!roteiro.carregar(arquivoEventos, erro)) {
+            std::fprintf(stderr, "roteiro invalido: %s\n", erro.c_str());
+            return 1;
+        }
+    }
+
+    // Cada mundo escreve só no próprio resultado; a chamadora também trabalha
+    std::vector<ResultadoMundo> resultados(mundos);
+    auto inicio = std::chrono::steady_clock::now();
+    {
+        PoolTrabalho pool(std::max(0, threads - 1));
+        pool.executar(mundos, [&](int i) {
+            simularMundo(sementeBase + static_cast<uint64_t>(i), tempoAlvo, amostragem, roteiro, resultados[i]);
+        });
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    // Agregação
+    const int numAmostras = static_cast<int>(tempoAlvo / amostragem) + 1;
+    std::vector<int> ativos(numAmostras, 0);
+    std::vector<double> somaPopulacao(numAmostras, 0.0);
+    std::vector<std::array<int, NUM_TIPOS_ORGANISMO>> sobreviventes(numAmostras);
+    for (auto& s : sobreviventes) s.fill(0);
+    std::array<int, NUM_TIPOS_ORGANISMO> extintas{}, ausentes{};
+    std::map<std::string, EstatisticaMissao> missoes;
+    std::vector<float> temposColapso;
+
+    for (const ResultadoMundo& r : resultados) {
+        for (int k = 0; k < numAmostras; k++) {
+            if (!r.ativo[k]) continue;
+            ativos[k]++;
+            somaPopulacao[k] += r.populacaoTotal[k];
+            for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+                if (r.vivosPorTipo[k][t] > 0) sobreviventes[k][t]++;
+            }
+        }
+        for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+            extintas[t] += r.extintaAlgumaVez[t];
+            ausentes[t] += r.ausenteNoFim[t];
+        }
+        for (const auto& m : r.missoesCompletadas) missoes[m.first].tempos.push_back(m.second);
+        for (const auto& m : r.missoesFalhadas) missoes[m.first].falhas++;
+        if (r.colapsou) temposColapso.push_back(r.tempoFinal);
+    }
+
+    std::printf("%d mundos x %.0fs em %.2fs (%d threads)\n", mundos, tempoAlvo, segundos, std::max(1, threads));
+    std::printf("colapsos: %zu (%.1f%%), tempo medio %.1fs\n", temposColapso.size(),
+                100.0 * temposColapso.size() / mundos, media(temposColapso));
+    std::printf("\n%-12s %10s %10s\n", "especie", "extinta%", "ausente%");
+    for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+        std::printf("%-12s %9.1f%% %9.1f%%\n", getEspecie(static_cast<TipoOrganismo>(t)).nome,
+                    100.0 * extintas[t] / mundos, 100.0 * ausentes[t] / mundos);
+    }
+    std::printf("\n%-28s %8s %8s %8s %8s\n", "missao", "concl.", "falhas", "media", "p50");
+    for (const auto& m : missoes) {
+        std::printf("%-28s %8zu %8d %7.1fs %7.1fs\n", m.first.c_str(), m.second.tempos.size(), m.second.falhas,
+                    media(m.second.tempos), percentil(m.second.tempos, 0.5f));
+    }
+
+    if (!arquivoCsv.empty()) {
+        FILE* f = std::fopen(arquivoCsv.c_str(), "w");
+        if (!f) {
+            std::fprintf(stderr, "nao foi possivel criar %s\n", arquivoCsv.c_str());
+            return 1;
+        }
+        // Fração dos mundos com a espécie viva em cada instante (mundos
+        // colapsados contam como sem sobreviventes)
+        std::fprintf(f, "tempo,mundos_ativos,populacao_media");
+        for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) std::fprintf(f, ",%s", getEspecie(static_cast<TipoOrganismo>(t)).nome);
+        std::fprintf(f, "\n");
+        for (int k = 0; k < numAmostras; k++) {
+            std::fprintf(f, "%.2f,%.4f,%.3f", k * amostragem, double(ativos[k]) / mundos,
+                         ativos[k] ? somaPopulacao[k] / ativos[k] : 0.0);
+            for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) std::fprintf(f, ",%.4f", double(sobreviventes[k][t]) / mundos);
+            std::fprintf(f, "\n");
+        }
+        std::fclose(f);
+    }
+
+    if (!arquivoJson.empty()) {
+        FILE* f = std::fopen(arquivoJson.c_str(), "w");
+        if (!f) {
+            std::fprintf(stderr, "nao foi possivel criar %s\n", arquivoJson.c_str());
+            return 1;
+        }
+        std::fprintf(f, "{\n  \"mundos\": %d,\n  \"tempo\": %g,\n  \"semente_base\": %llu,\n  \"amostragem\": %g,\n",
+                     mundos, tempoAlvo, static_cast<unsigned long long>(sementeBase), amostragem);
+        std::fprintf(f, "  \"colapsos\": {\"quantidade\": %zu, \"tempo_medio\": %g},\n",
+                     temposColapso.size(), media(temposColapso));
+        std::fprintf(f, "  \"especies\": [\n");
+        for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+            std::fprintf(f, "    {\"nome\": \"%s\", \"extinta_alguma_vez\": %g, \"ausente_no_fim\": %g}%s\n",
+                         getEspecie(static_cast<TipoOrganismo>(t)).nome, double(extintas[t]) / mundos,
+                         double(ausentes[t]) / mundos, t + 1 < NUM_TIPOS_ORGANISMO ? "," : "");
+        }
+        std::fprintf(f, "  ],\n  \"missoes\": [\n");
+        size_t m = 0;
+        for (const auto& par : missoes) {
+            const std::vector<float>& tempos = par.second.tempos;
+            std::fprintf(f, "    {\"nome\": \"%s\", \"concluidas\": %zu, \"falhas\": %d, \"tempo_medio\": %g, "
+                            "\"tempo_p10\": %g, \"tempo_p50\": %g, \"tempo_p90\": %g}%s\n",
+                         par.first.c_str(), tempos.size(), par.second.falhas, media(tempos),
+                         percentil(tempos, 0.1f), percentil(tempos, 0.5f), percentil(tempos, 0.9f),
+                         ++m < missoes.size() ? "," : "");
+        }
+        std::fprintf(f, "  ],\n  \"sobrevivencia\": [\n");
+        for (int k = 0; k < numAmostras; k++) {
+            std::fprintf(f, "    {\"tempo\": %g, \"mundos_ativos\": %g, \"populacao_media\": %g, \"especies\": [",
+                         k * amostragem, double(ativos[k]) / mundos, ativos[k] ? somaPopulacao[k] / ativos[k] : 0.0);
+            for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+                std::fprintf(f, "%s%g", t ? ", " : "", double(sobreviventes[k][t]) / mundos);
+            }
+            std::fprintf(f, "]}%s\n", k + 1 < numAmostras ? "," : "");
+        }
+        std::fprintf(f, "  ]\n}\n");
+        std::fclose(f);
+    }
+    return 0;
+}
@@ -0,0 +1,271 @@
+// Executa a simulação sem janela, o mais rápido que a CPU permitir.
+//
+// Uso: observador_headless [--tempo SEGUNDOS] [--taxa TICKS_POR_SEGUNDO] [--relatorio SEGUNDOS]
+//                           [--threads N] [--seed N] [--linhagem ARQUIVO] [--rapido]
+//                           [--replay ARQUIVO] [--carregar SNAPSHOT] [--salvar SNAPSHOT]
+//                           [--autosave ARQUIVO] [--telemetria ARQUIVO] [--perfil]
+//                           [--populacao-maxima N]
+//
+// --rapido usa Simulacao::passoRapido: zonas sem evento andam um segundo por
+// vez em vez de tick a tick (observação longa, não a mesma partida).
+// --replay grava a execução para observador_replay. --carregar parte de um
+// snapshot (F5 no jogo) em vez da semente; --salvar grava um no final, para
+// continuar experimentos longos em etapas. --autosave salva em segundo plano
+// a cada minuto simulado (só as páginas alteradas); se a execução cair,
+// --carregar no mesmo arquivo retoma do último salvamento completo.
+// --telemetria grava uma amostra por tick (observador_telemetria lê).
+// --perfil mede cada passo por subsistema (ver Perfilador) e imprime os
+// percentis dos últimos passos no final. --populacao-maxima troca o teto de
+// organismos por zona (ParametrosSimulacao::populacaoMaximaZona).
+
+#include "Simulacao.hpp"
+#include "AutoSalvamento.hpp"
+#include "Perfilador.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <ctime>
+#include <memory>
+#include <string>
+#include <vector>
+
+static void imprimirEstado(const Simulacao& sim) {
+    const Populacao& nucleo = sim.getPopulacao(ZonaPlaneta::NUCLEO);
+    const Populacao& habitavel = sim.getPopulacao(ZonaPlaneta::HABITAVEL);
+    const Populacao& periferia = sim.getPopulacao(ZonaPlaneta::PERIFERIA);
+    std::printf("t=%8.1fs fase=%d pop N/H/P=%3d/%3d/%3d energia N/H/P=%5.1f/%5.1f/%5.1f "
+                "consciencia=%6.1f vida=%5.1f\n",
+                sim.getTempoTotal(), sim.getFase(),
+                nucleo.getTamanho(), habitavel.getTamanho(), periferia.getTamanho(),
+                nucleo.energiaMedia(), habitavel.energiaMedia(), periferia.energiaMedia(),
+                sim.getConscienciaMedia(), sim.getVidaSupercomputador());
+}
+
+// Relê a genealogia gravada e mede a linhagem mais longa. As linhas estão
+// em ordem de nascimento, então o pai sempre aparece antes do filho.
+static void resumirLinhagem(const std::string& caminho) {
+    RegistroLinhagem registro;
+    if (!registro.carregar(caminho)) {
+        std::fprintf(stderr, "nao foi possivel ler %s\n", caminho.c_str());
+        return;
+    }
+    std::vector<uint32_t> profundidade(registro.quantidade(), 0);
+    uint32_t maior = 0;
+    size_t comPai = 0;
+    for (size_t i = 0; i < registro.quantidade(); i++) {
+        size_t pai = registro.buscar(registro.idPai[i]);
+        if (pai != RegistroLinhagem::NAO_ENCONTRADO) {
+            profundidade[i] = profundidade[pai] + 1;
+            comPai++;
+        }
+        maior = std::max(maior, profundidade[i]);
+    }
+    std::printf("linhagem: %zu nascimentos (%zu por reproducao), maior linhagem %u geracoes\n",
+                registro.quantidade(), comPai, maior);
+}
+
+int main(int argc, char** argv) {
+    float tempoAlvo = 600.0f;
+    float taxaTick = Simulacao::TAXA_TICK_PADRAO;
+    float intervaloRelatorio = 60.0f;
+    int threads = -1; // -1 = padrão da Simulacao
+    int populacaoMaxima = 0; // 0 = padrão
+    uint64_t semente = static_cast<uint64_t>(time(nullptr));
+    std::string arquivoLinhagem, arquivoReplay, arquivoCarregar, arquivoSalvar, arquivoAutosave,
+                arquivoTelemetria;
+    bool rapido = false;
+    bool perfil = false;
+    bool taxaInformada = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--tempo") == 0 && i + 1 < argc) {
+            tempoAlvo = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--taxa") == 0 && i + 1 < argc) {
+            taxaTick = std::strtof(argv[++i], nullptr);
+            taxaInformada = true;
+        } else if (std::strcmp(argv[i], "--relatorio") == 0 && i + 1 < argc) {
+            intervaloRelatorio = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            semente = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--linhagem") == 0 && i + 1 < argc) {
+            arquivoLinhagem = argv[++i];
+        } else if (std::strcmp(argv[i], "--replay") == 0 && i + 1 < argc) {
+            arquivoReplay = argv[++i];
+        } else if (std::strcmp(argv[i], "--carregar") == 0 && i + 1 < argc) {
+            arquivoCarregar = argv[++i];
+        } else if (std::strcmp(argv[i], "--salvar") == 0 && i + 1 < argc) {
+            arquivoSalvar = argv[++i];
+        } else if (std::strcmp(argv[i], "--autosave") == 0 && i + 1 < argc) {
+            arquivoAutosave = argv[++i];
+        } else if (std::strcmp(argv[i], "--telemetria") == 0 && i + 1 < argc) {
+            arquivoTelemetria = argv[++i];
+        } else if (std::strcmp(argv[i], "--populacao-maxima") == 0 && i + 1 < argc) {
+            populacaoMaxima = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--rapido") == 0) {
+            rapido = true;
+        } else if (std::strcmp(argv[i], "--perfil") == 0) {
+            perfil = true;
+        } else {
+            std::fprintf(stderr, "uso: %s [--tempo S] [--taxa HZ] [--relatorio S] [--threads N] [--seed N] [--linhagem ARQUIVO] [--rapido]\n"
+                                 "          [--replay ARQUIVO] [--carregar SNAPSHOT] [--salvar SNAPSHOT] [--autosave ARQUIVO]\n"
+                                 "          [--telemetria ARQUIVO] [--perfil] [--populacao-maxima N]\n", argv[0]);
+            return 1;
+        }
+    }
+    if (taxaTick <= 0 || tempoAlvo <= 0) {
+        std::fprintf(stderr, "--tempo e --taxa precisam ser positivos\n");
+        return 1;
+    }
+
+    Simulacao sim;
+    if (populacaoMaxima > 0) {
+        ParametrosSimulacao parametros;
+        parametros.populacaoMaximaZona = static_cast<float>(populacaoMaxima);
+        sim.setParametros(parametros);
+    }
+    if (!arquivoLinhagem.empty() && !sim.ativarLinhagem().abrirArquivo(arquivoLinhagem)) {
+        std::fprintf(stderr, "nao foi possivel criar %s\n", arquivoLinhagem.c_str());
+        return 1;
+    }
+    sim.inicializar(semente);
+    if (!arquivoCarregar.empty()) {
+        // O replay parte de uma semente; um mundo carregado não tem como
+        if (!arquivoReplay.empty()) {
+            std::fprintf(stderr, "--replay nao combina com --carregar\n");
+            return 1;
+        }
+        std::string erro;
+        auto inicioCarga = std::chrono::steady_clock::now();
+        // Um salvamento automático pode ter delta pendente; sem ele não muda nada
+        if (!AutoSalvamento::consolidar(arquivoCarregar, erro) || !sim.carregarSnapshot(arquivoCarregar, erro)) {
+            std::fprintf(stderr, "%s\n", erro.c_str());
+            return 1;
+        }
+        std::printf("carregado %s (t=%.1fs, %d organismos) em %.3fs\n", arquivoCarregar.c_str(),
+                    sim.getTempoTotal(), sim.getPopulacaoTotal(),
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - inicioCarga).count());
+    }
+    if (!arquivoReplay.empty() && !sim.gravarReplay(arquivoReplay)) {
+        std::fprintf(stderr, "nao foi possivel criar %s\n", arquivoReplay.c_str());
+        return 1;
+    }
+    if (!arquivoTelemetria.empty() && !sim.gravarTelemetria(arquivoTelemetria)) {
+        std::fprintf(stderr, "nao foi possivel criar %s\n", arquivoTelemetria.c_str());
+        return 1;
+    }
+    std::printf("semente %llu\n", static_cast<unsigned long long>(sim.getSemente()));
+    // Um snapshot traz a própria taxa; --taxa só a substitui se informada
+    if (arquivoCarregar.empty() || taxaInformada) sim.setTaxaTick(taxaTick);
+    if (threads >= 0) sim.setThreadsTrabalho(threads);
+
+    auto inicio = std::chrono::steady_clock::now();
+    long long passos = 0;
+    double proximoRelatorio = sim.getTempoSimulacao() + intervaloRelatorio;
+
+    const float intervaloAutosave = 60.0f;
+    std::unique_ptr<AutoSalvamento> autosave;
+    if (!arquivoAutosave.empty()) autosave = std::make_unique<AutoSalvamento>(arquivoAutosave);
+    double proximoAutosave = sim.getTempoSimulacao() + intervaloAutosave;
+    double segundosCaptura = 0.0, maiorCaptura = 0.0;
+
+    Perfilador& perfilador = Perfilador::instancia();
+    perfilador.setAtivo(perfil);
+    auto inicioPasso = std::chrono::steady_clock::now();
+    // O último passo já imprimiu o estado (evita a linha final repetida)
+    bool estadoImpresso = false;
+
+    while (sim.getTempoSimulacao() < tempoAlvo && !sim.sistemaColapsado()) {
+        ResultadoAtualizacao r = rapido ? sim.passoRapido() : sim.passo();
+        passos++;
+        if (perfil) {
+            // Cada passo é um "quadro" do Perfilador
+            auto agora = std::chrono::steady_clock::now();
+            perfilador.fecharQuadro(std::chrono::duration<float>(agora - inicioPasso).count());
+            inicioPasso = agora;
+        }
+
+        if (r.missaoCompletada) std::printf("  missao completada: %s\n", r.nomeMissao.c_str());
+        if (r.missaoFalhada) std::printf("  missao falhada: %s\n", r.nomeMissao.c_str());
+        if (r.faseAvancou) std::printf("  fase %d\n", sim.getFase());
+
+        estadoImpresso = false;
+        if (intervaloRelatorio > 0 && sim.getTempoSimulacao() >= proximoRelatorio) {
+            imprimirEstado(sim);
+            proximoRelatorio += intervaloRelatorio;
+            estadoImpresso = true;
+        }
+
+        // Se a gravação anterior ainda estiver em andamento, tenta no próximo passo
+        if (autosave && sim.getTempoSimulacao() >= proximoAutosave) {
+            auto inicioCaptura = std::chrono::steady_clock::now();
+            if (autosave->capturar(sim)) {
+                double s = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicioCaptura).count();
+                segundosCaptura += s;
+                maiorCaptura = std::max(maiorCaptura, s);
+                proximoAutosave += intervaloAutosave;
+            }
+        }
+    }
+
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+    if (!estadoImpresso) imprimirEstado(sim);
+    std::printf("%lld passos (%llu ticks) em %.3fs (%.0fx tempo real)\n", passos,
+                static_cast<unsigned long long>(sim.getTickAtual()), segundos,
+                segundos > 0 ? sim.getTempoSimulacao() / segundos : 0.0);
+
+    if (perfil) {
+        Perfilador::Percentis q = perfilador.getPercentisQuadro();
+        std::printf("perfil dos ultimos %d passos (ms)           p50      p95      p99\n", Perfilador::JANELA);
+        std::printf("  %-38s %8.4f %8.4f %8.4f\n", "passo", q.p50, q.p95, q.p99);
+        for (int s = 0; s < NUM_SECOES_PERFIL; s++) {
+            SecaoPerfil secao = static_cast<SecaoPerfil>(s);
+            Perfilador::Percentis p = perfilador.getPercentis(secao);
+            if (p.p99 <= 0) continue;
+            std::printf("  %*s%-*s %8.4f %8.4f %8.4f\n", 2 * Perfilador::getNivel(secao), "",
+                        38 - 2 * Perfilador::getNivel(secao), Perfilador::getNome(secao), p.p50, p.p95, p.p99);
+        }
+    }
+
+    if (!arquivoSalvar.empty()) {
+        auto inicioGravacao = std::chrono::steady_clock::now();
+        if (!sim.salvarSnapshot(arquivoSalvar)) {
+            std::fprintf(stderr, "nao foi possivel gravar %s\n", arquivoSalvar.c_str());
+            return 1;
+        }
+        std::printf("snapshot %s (%d organismos) em %.3fs\n", arquivoSalvar.c_str(), sim.getPopulacaoTotal(),
+                    std::chrono::duration<double>(std::chrono::steady_clock::now() - inicioGravacao).count());
+    }
+
+    if (autosave) {
+        autosave->aguardar();
+        uint64_t capturas = autosave->getTotalCapturas();
+        std::printf("autosave %s: %llu capturas (%llu adiadas), captura media %.2fms, maior %.2fms%s\n",
+                    arquivoAutosave.c_str(), static_cast<unsigned long long>(capturas),
+                    static_cast<unsigned long long>(autosave->getCapturasDescartadas()),
+                    capturas > 0 ? 1000.0 * segundosCaptura / capturas : 0.0, 1000.0 * maiorCaptura,
+                    autosave->getFalhou() ? " (ultima gravacao falhou)" : "");
+    }
+
+    if (const RegistroTelemetria* telemetria = sim.getTelemetria()) {
+        uint64_t descartadas = telemetria->getDescartadas();
+        sim.encerrarTelemetria();
+        std::printf("telemetria %s (%llu amostras descartadas)\n", arquivoTelemetria.c_str(),
+                    static_cast<unsigned long long>(descartadas));
+    }
+
+    if (sim.gravandoReplay()) {
+        std::printf("checksum %016llx -> %s\n", static_cast<unsigned long long>(sim.calcularChecksum()),
+                    arquivoReplay.c_str());
+        sim.encerrarReplay();
+    }
+
+    if (RegistroLinhagem* linhagem = sim.getLinhagem()) {
+        linhagem->fecharArquivo();
+        resumirLinhagem(arquivoLinhagem);
+    }
+    return 0;
+}
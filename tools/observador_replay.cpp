@@ -0,0 +1,135 @@
+// Reexecuta, sem janela e o mais rápido possível, uma partida gravada em
+// replay (ver RegistroReplay) e confere o checksum do estado final com o
+// gravado. Para relatos de bug reproduzíveis e como carga realista de
+// benchmark.
+//
+// Uso: observador_replay ARQUIVO [--threads N] [--repeticoes N] [--listar]
+//
+// --repeticoes roda a partida N vezes e informa o melhor tempo; --listar
+// imprime os comandos gravados. Sai com 0 se o estado final confere, 2 se
+// diverge e 1 em erro de uso.
+
+#include "Simulacao.hpp"
+#include "RegistroReplay.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <string>
+
+static const char* nomeComando(TipoComando tipo) {
+    switch (tipo) {
+        case TipoComando::ATIVAR_EVENTO: return "ativar_evento";
+        case TipoComando::REDUZIR_TEMPO_EVENTO: return "reduzir_tempo_evento";
+        case TipoComando::CANCELAR_EVENTOS: return "cancelar_eventos";
+        case TipoComando::ACAO_MANUAL: return "acao_manual";
+        case TipoComando::REPARAR: return "reparar";
+        case TipoComando::PASSO_RAPIDO: return "passo_rapido";
+        case TipoComando::TAXA_TICK: return "taxa_tick";
+        case TipoComando::VELOCIDADE: return "velocidade";
+        case TipoComando::FIM: return "fim";
+    }
+    return "?";
+}
+
+// Comandos de um tick são aplicados antes do avanço seguinte, na ordem em
+// que foram gravados; PASSO_RAPIDO troca esse avanço por um passoRapido()
+static void reproduzir(const RegistroReplay& replay, Simulacao& sim) {
+    const std::vector<ComandoReplay>& comandos = replay.getComandos();
+    size_t proximo = 0;
+    for (;;) {
+        bool rapido = false;
+        while (proximo < comandos.size() && comandos[proximo].tick == sim.getTickAtual()) {
+            const ComandoReplay& c = comandos[proximo++];
+            if (c.tipo == TipoComando::PASSO_RAPIDO) {
+                rapido = true;
+                break;
+            }
+            sim.aplicarComando(c);
+        }
+        if (!rapido && proximo >= comandos.size() && sim.getTickAtual() >= replay.getTickFinal()) break;
+        if (rapido) {
+            sim.passoRapido();
+        } else {
+            sim.passo();
+        }
+    }
+}
+
+int main(int argc, char** argv) {
+    const char* arquivo = nullptr;
+    int threads = 0;
+    int repeticoes = 1;
+    bool listar = false;
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--repeticoes") == 0 && i + 1 < argc) {
+            repeticoes = std::max(1, std::atoi(argv[++i]));
+        } else if (std::strcmp(argv[i], "--listar") == 0) {
+            listar = true;
+        } else if (argv[i][0] != '-' && !arquivo) {
+            arquivo = argv[i];
+        } else {
+            arquivo = nullptr;
+            break;
+        }
+    }
+    if (!arquivo) {
+        std::fprintf(stderr, "uso: %s ARQUIVO [--threads N] [--repeticoes N] [--listar]\n", argv[0]);
+        return 1;
+    }
+
+    RegistroReplay replay;
+    std::string erro;
+    if (!replay.carregar(arquivo, erro)) {
+        std::fprintf(stderr, "%s\n", erro.c_str());
+        return 1;
+    }
+
+    std::printf("semente %llu, taxa %.0f Hz, %zu comandos, %llu ticks%s\n",
+                static_cast<unsigned long long>(replay.getSemente()), replay.getTaxaTick(),
+                replay.getComandos().size(), static_cast<unsigned long long>(replay.getTickFinal()),
+                replay.estaEncerrado() ? "" : " (gravacao interrompida)");
+    if (listar) {
+        for (const ComandoReplay& c : replay.getComandos()) {
+            std::printf("  tick %8llu  %-20s zona=%d codigo=%d valor=%g\n", static_cast<unsigned long long>(c.tick),
+                        nomeComando(c.tipo), c.zona, c.codigo, c.valor);
+        }
+    }
+
+    uint64_t checksum = 0;
+    double melhor = 0;
+    Simulacao sim;
+    for (int r = 0; r < repeticoes; r++) {
+        sim.setThreadsTrabalho(threads);
+        sim.setTaxaTick(replay.getTaxaTick());
+        sim.setFrequencias(replay.getFrequencias());
+        sim.setParametros(replay.getParametros());
+
+        auto inicio = std::chrono::steady_clock::now();
+        sim.inicializar(replay.getSemente());
+        reproduzir(replay, sim);
+        double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+        melhor = r == 0 ? segundos : std::min(melhor, segundos);
+        checksum = sim.calcularChecksum();
+    }
+
+    std::printf("t=%.1fs fase=%d populacao=%d em %.3fs (%.0f ticks/s)\n", sim.getTempoTotal(), sim.getFase(),
+                sim.getPopulacaoTotal(), melhor, melhor > 0 ? sim.getTickAtual() / melhor : 0.0);
+    std::printf("checksum %016llx", static_cast<unsigned long long>(checksum));
+    if (!replay.estaEncerrado()) {
+        std::printf(" (nada a conferir)\n");
+        return 0;
+    }
+    if (checksum != replay.getChecksumFinal() || sim.getTickAtual() != replay.getTickFinal()) {
+        std::printf(" DIVERGE do gravado %016llx (tick %llu)\n",
+                    static_cast<unsigned long long>(replay.getChecksumFinal()),
+                    static_cast<unsigned long long>(replay.getTickFinal()));
+        return 2;
+    }
+    std::printf(" confere\n");
+    return 0;
+}
@@ -0,0 +1,367 @@
+// Varredura de parâmetros: roda a simulação sem janela sobre uma grade ou um
+// hipercubo latino de valores de ParametrosSimulacao e grava uma linha por
+// execução num arquivo colunar. Para calibrar ambientes e espécies.
+//
+// Uso: observador_sweep ESPEC [--repeticoes N] [--tempo SEGUNDOS] [--seed BASE]
+//                       [--threads N] [--eventos ARQUIVO] [--rapido]
+//                       [--saida ARQUIVO] [--csv ARQUIVO]
+//
+// ESPEC é um arquivo texto:
+//
+//     modo lhs 64                       # ou: modo grade
+//     # parametro               minimo  maximo  [niveis, só na grade]
+//     NUCLEO.temperaturaBase    0.7     1.0     4
+//     PLANTA.chanceReproducao   0.002   0.006   3
+//
+// (nomes em ParametrosSimulacao::localizar). A grade é o produto cartesiano
+// dos níveis; o hipercubo sorteia N pontos com um valor por estrato em cada
+// parâmetro. Cada ponto roda com as sementes BASE..BASE+repeticoes-1, as
+// mesmas para todos os pontos, então as diferenças entre pontos não se
+// confundem com sorte.
+//
+// Arquivo colunar (--saida, padrão sweep.obsw), ordem de bytes da máquina:
+//   "OBSW" + uint32 versão + uint32 colunas + uint64 linhas
+//   nomes das colunas, 32 bytes cada (terminados em zero)
+//   cada coluna inteira, float64
+// Em numpy: as colunas começam em 20 + 32 * colunas.
+
+#include "Simulacao.hpp"
+#include "ParametrosSimulacao.hpp"
+#include "RoteiroEventos.hpp"
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <cstdlib>
+#include <cstring>
+#include <fstream>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+struct Dimensao {
+    std::string nome;
+    float minimo;
+    float maximo;
+    int niveis;
+};
+
+struct Especificacao {
+    bool hipercubo = false;
+    int amostras = 0;
+    std::vector<Dimensao> dimensoes;
+};
+
+// Métricas de uma execução, na ordem das colunas finais do arquivo
+static const char* METRICAS[] = {
+    "colapsou", "tempo_final", "fase_final", "populacao_final",
+    "populacao_nucleo", "populacao_habitavel", "populacao_periferia",
+    "nascimentos", "mortes", "missoes_concluidas", "missoes_falhadas", "especies_vivas"
+};
+static constexpr int NUM_METRICAS = sizeof(METRICAS) / sizeof(METRICAS[0]);
+
+static bool lerEspecificacao(const std::string& caminho, Especificacao& espec, std::string& erro) {
+    std::ifstream arquivo(caminho);
+    if (!arquivo.is_open()) {
+        erro = "nao foi possivel abrir " + caminho;
+        return false;
+    }
+
+    ParametrosSimulacao teste;
+    std::string linha;
+    int numero = 0;
+    bool temModo = false;
+    while (std::getline(arquivo, linha)) {
+        numero++;
+        size_t comentario = linha.find('#');
+        if (comentario != std::string::npos) linha.erase(comentario);
+        std::istringstream campos(linha);
+        std::string primeiro;
+        if (!(campos >> primeiro)) continue;
+
+        std::string onde = caminho + ":" + std::to_string(numero) + ": ";
+        if (primeiro == "modo") {
+            std::string modo;
+            campos >> modo;
+            if (modo == "grade") {
+                espec.hipercubo = false;
+            } else if (modo == "lhs" && (campos >> espec.amostras) && espec.amostras > 0) {
+                espec.hipercubo = true;
+            } else {
+                erro = onde + "esperado 'modo grade' ou 'modo lhs N'";
+                return false;
+            }
+            temModo = true;
+            continue;
+        }
+
+        Dimensao d;
+        d.nome = primeiro;
+        d.niveis = 0;
+        if (!teste.localizar(d.nome)) {
+            erro = onde + "parametro desconhecido '" + d.nome + "'";
+            return false;
+        }
+        if (!(campos >> d.minimo >> d.maximo) || d.maximo < d.minimo) {
+            erro = onde + "esperado 'parametro minimo maximo [niveis]'";
+            return false;
+        }
+        campos >> d.niveis;
+        espec.dimensoes.push_back(d);
+    }
+
+    if (!temModo || espec.dimensoes.empty()) {
+        erro = caminho + ": precisa de uma linha 'modo' e ao menos um parametro";
+        return false;
+    }
+    if (!espec.hipercubo) {
+        for (const Dimensao& d : espec.dimensoes) {
+            if (d.niveis < 1) {
+                erro = caminho + ": na grade, '" + d.nome + "' precisa do numero de niveis";
+                return false;
+            }
+        }
+    }
+    return true;
+}
+
+// pontos[p][d] = valor do parâmetro d no ponto p
+static std::vector<std::vector<float>> gerarPontos(const Especificacao& espec, uint64_t semente) {
+    std::vector<std::vector<float>> pontos;
+    const size_t numDim = espec.dimensoes.size();
+
+    if (!espec.hipercubo) {
+        // Produto cartesiano, com o último parâmetro variando mais rápido
+        size_t total = 1;
+        for (const Dimensao& d : espec.dimensoes) total *= static_cast<size_t>(d.niveis);
+        pontos.assign(total, std::vector<float>(numDim));
+        for (size_t p = 0; p < total; p++) {
+            size_t resto = p;
+            for (size_t d = numDim; d-- > 0;) {
+                const Dimensao& dim = espec.dimensoes[d];
+                int nivel = static_cast<int>(resto % dim.niveis);
+                resto /= dim.niveis;
+                float t = dim.niveis > 1 ? float(nivel) / (dim.niveis - 1) : 0.5f;
+                pontos[p][d] = dim.minimo + t * (dim.maximo - dim.minimo);
+            }
+        }
+        return pontos;
+    }
+
+    // Hipercubo latino: em cada parâmetro, uma permutação dos N estratos e
+    // um ponto uniforme dentro de cada um
+    const int n = espec.amostras;
+    GeradorAleatorio gerador(semente, 0x5EEDu);
+    pontos.assign(n, std::vector<float>(numDim));
+    std::vector<int> estratos(n);
+    for (size_t d = 0; d < numDim; d++) {
+        for (int i = 0; i < n; i++) estratos[i] = i;
+        for (int i = n - 1; i > 0; i--) std::swap(estratos[i], estratos[gerador.inteiro(i + 1)]);
+        const Dimensao& dim = espec.dimensoes[d];
+        for (int i = 0; i < n; i++) {
+            float t = (estratos[i] + gerador.uniforme()) / n;
+            pontos[i][d] = dim.minimo + t * (dim.maximo - dim.minimo);
+        }
+    }
+    return pontos;
+}
+
+static void simular(const ParametrosSimulacao& parametros, uint64_t semente, float tempoAlvo, bool rapido,
+                    const RoteiroEventos& roteiroBase, double* metricas) {
+    Simulacao sim;
+    sim.setThreadsTrabalho(0);   // o paralelismo é entre execuções
+    sim.setParametros(parametros);
+    sim.inicializar(semente);
+    RoteiroEventos roteiro = roteiroBase;
+
+    int concluidas = 0, falhadas = 0;
+    while (sim.getTempoSimulacao() < tempoAlvo && !sim.sistemaColapsado()) {
+        roteiro.aplicar(sim);
+        ResultadoAtualizacao res = rapido ? sim.passoRapido() : sim.passo();
+        concluidas += res.missaoCompletada;
+        falhadas += res.missaoFalhada;
+    }
+
+    int nascimentos = 0, mortes = 0;
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        const Populacao& pop = sim.getPopulacao(static_cast<ZonaPlaneta>(z));
+        nascimentos += pop.getTotalNascimentos();
+        mortes += pop.getTotalMortes();
+    }
+    int especiesVivas = 0;
+    for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+        int vivos = 0;
+        for (int z = 0; z < NUM_ZONAS; z++) {
+            vivos += sim.getPopulacao(static_cast<ZonaPlaneta>(z)).contarPorTipo(static_cast<TipoOrganismo>(t));
+        }
+        especiesVivas += (vivos > 0);
+    }
+
+    double valores[NUM_METRICAS] = {
+        sim.sistemaColapsado() ? 1.0 : 0.0, sim.getTempoSimulacao(), double(sim.getFase()), double(sim.getPopulacaoTotal()),
+        double(sim.getPopulacao(ZonaPlaneta::NUCLEO).getTamanho()),
+        double(sim.getPopulacao(ZonaPlaneta::HABITAVEL).getTamanho()),
+        double(sim.getPopulacao(ZonaPlaneta::PERIFERIA).getTamanho()),
+        double(nascimentos), double(mortes), double(concluidas), double(falhadas), double(especiesVivas)
+    };
+    std::copy(valores, valores + NUM_METRICAS, metricas);
+}
+
+static bool gravarColunar(const std::string& caminho, const std::vector<std::string>& nomes,
+                          const std::vector<std::vector<double>>& colunas, uint64_t linhas) {
+    FILE* f = std::fopen(caminho.c_str(), "wb");
+    if (!f) return false;
+    const uint32_t versao = 1;
+    const uint32_t numColunas = static_cast<uint32_t>(nomes.size());
+    std::fwrite("OBSW", 1, 4, f);
+    std::fwrite(&versao, sizeof(versao), 1, f);
+    std::fwrite(&numColunas, sizeof(numColunas), 1, f);
+    std::fwrite(&linhas, sizeof(linhas), 1, f);
+    for (const std::string& nome : nomes) {
+        char campo[32] = {};
+        std::strncpy(campo, nome.c_str(), sizeof(campo) - 1);
+        std::fwrite(campo, 1, sizeof(campo), f);
+    }
+    for (const std::vector<double>& coluna : colunas) {
+        std::fwrite(coluna.data(), sizeof(double), coluna.size(), f);
+    }
+    bool ok = std::ferror(f) == 0;
+    return std::fclose(f) == 0 && ok;
+}
+
+int main(int argc, char** argv) {
+    std::string arquivoEspec, arquivoEventos, arquivoCsv;
+    std::string arquivoSaida = "sweep.obsw";
+    int repeticoes = 4;
+    float tempoAlvo = 300.0f;
+    uint64_t sementeBase = 1;
+    bool rapido = false;
+    int threads = static_cast<int>(std::thread::hardware_concurrency());
+
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--repeticoes") == 0 && i + 1 < argc) {
+            repeticoes = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--tempo") == 0 && i + 1 < argc) {
+            tempoAlvo = std::strtof(argv[++i], nullptr);
+        } else if (std::strcmp(argv[i], "--seed") == 0 && i + 1 < argc) {
+            sementeBase = std::strtoull(argv[++i], nullptr, 10);
+        } else if (std::strcmp(argv[i], "--threads") == 0 && i + 1 < argc) {
+            threads = std::atoi(argv[++i]);
+        } else if (std::strcmp(argv[i], "--eventos") == 0 && i + 1 < argc) {
+            arquivoEventos = argv[++i];
+        } else if (std::strcmp(argv[i], "--saida") == 0 && i + 1 < argc) {
+            arquivoSaida = argv[++i];
+        } else if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            arquivoCsv = argv[++i];
+        } else if (std::strcmp(argv[i], "--rapido") == 0) {
+            rapido = true;
+        } else if (argv[i][0] != '-' && arquivoEspec.empty()) {
+            arquivoEspec = argv[i];
+        } else {
+            arquivoEspec.clear();
+            break;
+        }
+    }
+    if (arquivoEspec.empty()) {
+        std::fprintf(stderr, "uso: %s ESPEC [--repeticoes N] [--tempo S] [--seed BASE] [--threads N]\n"
+                             "          [--eventos ARQUIVO] [--rapido] [--saida ARQUIVO] [--csv ARQUIVO]\n", argv[0]);
+        std::fprintf(stderr, "parametros:");
+        for (const std::string& nome : ParametrosSimulacao::getNomes()) std::fprintf(stderr, " %s", nome.c_str());
+        std::fprintf(stderr, "\n");
+        return 1;
+    }
+    if (repeticoes <= 0 || tempoAlvo <= 0) {
+        std::fprintf(stderr, "--repeticoes e --tempo precisam ser positivos\n");
+        return 1;
+    }
+
+    Especificacao espec;
+    std::string erro;
+    if (!lerEspecificacao(arquivoEspec, espec, erro)) {
+        std::fprintf(stderr, "especificacao invalida: %s\n", erro.c_str());
+        return 1;
+    }
+    RoteiroEventos roteiro;
+    if (!arquivoEventos.empty() && !roteiro.carregar(arquivoEventos, erro)) {
+        std::fprintf(stderr, "roteiro invalido: %s\n", erro.c_str());
+        return 1;
+    }
+
+    const std::vector<std::vector<float>> pontos = gerarPontos(espec, sementeBase);
+    const size_t numDim = espec.dimensoes.size();
+    const size_t execucoes = pontos.size() * static_cast<size_t>(repeticoes);
+
+    // Colunas: ponto, repeticao, semente, um por parâmetro, métricas
+    std::vector<std::string> nomes = { "ponto", "repeticao", "semente" };
+    for (const Dimensao& d : espec.dimensoes) nomes.push_back(d.nome);
+    for (const char* m : METRICAS) nomes.push_back(m);
+    std::vector<std::vector<double>> colunas(nomes.size(), std::vector<double>(execucoes));
+
+    // Execução e = ponto e / repeticoes; cada uma escreve só a própria linha.
+    // As durações variam muito (colapsos terminam cedo): os índices são
+    // tomados um a um pelas threads do pool, que não ficam presas a uma
+    // fatia fixa.
+    auto inicio = std::chrono::steady_clock::now();
+    {
+        PoolTrabalho pool(std::max(0, threads - 1));
+        pool.executar(static_cast<int>(execucoes), [&](int e) {
+            size_t p = static_cast<size_t>(e) / repeticoes;
+            int r = e % repeticoes;
+            uint64_t semente = sementeBase + static_cast<uint64_t>(r);
+
+            ParametrosSimulacao parametros;
+            for (size_t d = 0; d < numDim; d++) *parametros.localizar(espec.dimensoes[d].nome) = pontos[p][d];
+
+            double metricas[NUM_METRICAS];
+            simular(parametros, semente, tempoAlvo, rapido, roteiro, metricas);
+
+            size_t c = 0;
+            colunas[c++][e] = double(p);
+            colunas[c++][e] = double(r);
+            colunas[c++][e] = double(semente);
+            for (size_t d = 0; d < numDim; d++) colunas[c++][e] = pontos[p][d];
+            for (int m = 0; m < NUM_METRICAS; m++) colunas[c++][e] = metricas[m];
+        });
+    }
+    double segundos = std::chrono::duration<double>(std::chrono::steady_clock::now() - inicio).count();
+
+    if (!gravarColunar(arquivoSaida, nomes, colunas, execucoes)) {
+        std::fprintf(stderr, "nao foi possivel gravar %s\n", arquivoSaida.c_str());
+        return 1;
+    }
+    if (!arquivoCsv.empty()) {
+        FILE* f = std::fopen(arquivoCsv.c_str(), "w");
+        if (!f) {
+            std::fprintf(stderr, "nao foi possivel criar %s\n", arquivoCsv.c_str());
+            return 1;
+        }
+        for (size_t c = 0; c < nomes.size(); c++) std::fprintf(f, "%s%s", c ? "," : "", nomes[c].c_str());
+        std::fprintf(f, "\n");
+        for (size_t e = 0; e < execucoes; e++) {
+            for (size_t c = 0; c < nomes.size(); c++) std::fprintf(f, "%s%.9g", c ? "," : "", colunas[c][e]);
+            std::fprintf(f, "\n");
+        }
+        std::fclose(f);
+    }
+
+    // Resumo por ponto: fração de colapsos e população final média
+    const size_t colColapso = 3 + numDim;
+    const size_t colPopulacao = colColapso + 3;
+    std::printf("%zu pontos x %d repeticoes (%s) x %.0fs em %.2fs (%d threads) -> %s\n",
+                pontos.size(), repeticoes, espec.hipercubo ? "lhs" : "grade", tempoAlvo, segundos,
+                std::max(1, threads), arquivoSaida.c_str());
+    std::printf("\n%6s", "ponto");
+    for (const Dimensao& d : espec.dimensoes) std::printf(" %24s", d.nome.c_str());
+    std::printf(" %9s %9s\n", "colapso%", "pop.final");
+    for (size_t p = 0; p < pontos.size(); p++) {
+        double colapsos = 0, populacao = 0;
+        for (int r = 0; r < repeticoes; r++) {
+            colapsos += colunas[colColapso][p * repeticoes + r];
+            populacao += colunas[colPopulacao][p * repeticoes + r];
+        }
+        std::printf("%6zu", p);
+        for (size_t d = 0; d < numDim; d++) std::printf(" %24.6g", pontos[p][d]);
+        std::printf(" %8.1f%% %9.1f\n", 100.0 * colapsos / repeticoes, populacao / repeticoes);
+    }
+    return 0;
+}
@@ -0,0 +1,85 @@
+// Lê a telemetria gravada por uma execução (ver RegistroTelemetria) e
+// imprime um resumo ou a exporta em CSV para planilhas e scripts.
+//
+// Uso: observador_telemetria ARQUIVO [--csv SAIDA]
+
+#include "Telemetria.hpp"
+#include "Especies.hpp"
+#include <algorithm>
+#include <cstdio>
+#include <cstring>
+#include <string>
+#include <vector>
+
+static void resumir(const std::vector<AmostraTelemetria>& amostras) {
+    static const char* ZONAS[NUM_ZONAS] = { "NUCLEO", "HABITAVEL", "PERIFERIA" };
+    const AmostraTelemetria& primeira = amostras.front();
+    const AmostraTelemetria& ultima = amostras.back();
+    std::printf("%zu amostras, ticks %llu..%llu, t=%.1fs..%.1fs, fase final %d\n", amostras.size(),
+                static_cast<unsigned long long>(primeira.tick), static_cast<unsigned long long>(ultima.tick),
+                primeira.tempo, ultima.tempo, ultima.fase);
+
+    for (int z = 0; z < NUM_ZONAS; z++) {
+        int menor = primeira.populacao[z], maior = primeira.populacao[z];
+        float tempMin = primeira.temperatura[z], tempMax = primeira.temperatura[z];
+        int comEvento = 0;
+        for (const AmostraTelemetria& a : amostras) {
+            menor = std::min(menor, a.populacao[z]);
+            maior = std::max(maior, a.populacao[z]);
+            tempMin = std::min(tempMin, a.temperatura[z]);
+            tempMax = std::max(tempMax, a.temperatura[z]);
+            if (a.evento[z] != 0) comEvento++;
+        }
+        std::printf("  %-9s populacao %3d..%3d (final %3d)  temperatura %6.1f..%6.1f  com evento %5.1f%%\n",
+                    ZONAS[z], menor, maior, ultima.populacao[z], tempMin, tempMax,
+                    100.0 * comEvento / amostras.size());
+    }
+
+    std::printf("  especies vivas no fim:");
+    for (int t = 0; t < NUM_TIPOS_ORGANISMO; t++) {
+        if (ultima.populacaoTipo[t] > 0) std::printf(" %s=%d", ESPECIES[t].nome, ultima.populacaoTipo[t]);
+    }
+    std::printf("\n  consciencia final %.1f, vida %.1f, %d missoes, %d pontos\n",
+                ultima.consciencia, ultima.vidaSupercomputador, ultima.missoesCompletadas, ultima.pontuacao);
+}
+
+int main(int argc, char** argv) {
+    std::string arquivo, arquivoCsv;
+    for (int i = 1; i < argc; i++) {
+        if (std::strcmp(argv[i], "--csv") == 0 && i + 1 < argc) {
+            arquivoCsv = argv[++i];
+        } else if (argv[i][0] != '-' && arquivo.empty()) {
+            arquivo = argv[i];
+        } else {
+            arquivo.clear();
+            break;
+        }
+    }
+    if (arquivo.empty()) {
+        std::fprintf(stderr, "uso: %s ARQUIVO [--csv SAIDA]\n", argv[0]);
+        return 1;
+    }
+
+    std::vector<AmostraTelemetria> amostras;
+    std::string erro;
+    if (!RegistroTelemetria::carregar(arquivo, amostras, erro)) {
+        std::fprintf(stderr, "%s\n", erro.c_str());
+        return 1;
+    }
+    if (amostras.empty()) {
+        std::fprintf(stderr, "%s nao tem amostras\n", arquivo.c_str());
+        return 1;
+    }
+
+    if (!arquivoCsv.empty()) {
+        if (!RegistroTelemetria::exportarCSV(amostras, arquivoCsv)) {
+            std::fprintf(stderr, "nao foi possivel gravar %s\n", arquivoCsv.c_str());
+            return 1;
+        }
+        std::printf("%zu amostras x %zu colunas -> %s\n", amostras.size(),
+                    RegistroTelemetria::getColunas().size(), arquivoCsv.c_str());
+        return 0;
+    }
+    resumir(amostras);
+    return 0;
+}